@@ -79,6 +79,12 @@
 
 #endif // OPENTHREAD_RADIO
 
+#if !OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+#ifndef OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE 1
+#endif
+#endif
+
 #ifndef OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
 #define OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE 1
 #endif
@@ -1030,6 +1030,48 @@ void otPlatRadioClearSrcMatchShortEntries(otInstance *aInstance);
  */
 void otPlatRadioClearSrcMatchExtEntries(otInstance *aInstance);
 
+/**
+ * Add a number of short addresses to the source address match table.
+ *
+ * The entries are added in order. On failure, the first @p aNumAdded entries were added and the remaining ones were
+ * not. Radio platforms where each table update is costly (e.g., a radio behind a host-RCP interface) can provide this
+ * function to program several entries at once. The default implementation calls `otPlatRadioAddSrcMatchShortEntry()`
+ * for each entry.
+ *
+ * @param[in]  aInstance        The OpenThread instance structure.
+ * @param[in]  aShortAddresses  A pointer to an array of short addresses to be added.
+ * @param[in]  aNumEntries      The number of entries in @p aShortAddresses.
+ * @param[out] aNumAdded        A pointer to output the number of entries that were added.
+ *
+ * @retval OT_ERROR_NONE      Successfully added all short addresses to the source match table.
+ * @retval OT_ERROR_NO_BUFS   No available entry in the source match table.
+ *
+ */
+otError otPlatRadioAddSrcMatchShortEntries(otInstance           *aInstance,
+                                           const otShortAddress *aShortAddresses,
+                                           uint16_t              aNumEntries,
+                                           uint16_t             *aNumAdded);
+
+/**
+ * Add a number of extended addresses to the source address match table.
+ *
+ * The entries are added in order. On failure, the first @p aNumAdded entries were added and the remaining ones were
+ * not. The default implementation calls `otPlatRadioAddSrcMatchExtEntry()` for each entry.
+ *
+ * @param[in]  aInstance      The OpenThread instance structure.
+ * @param[in]  aExtAddresses  A pointer to an array of extended addresses to be added stored in little-endian byte order.
+ * @param[in]  aNumEntries    The number of entries in @p aExtAddresses.
+ * @param[out] aNumAdded      A pointer to output the number of entries that were added.
+ *
+ * @retval OT_ERROR_NONE      Successfully added all extended addresses to the source match table.
+ * @retval OT_ERROR_NO_BUFS   No available entry in the source match table.
+ *
+ */
+otError otPlatRadioAddSrcMatchExtEntries(otInstance         *aInstance,
+                                         const otExtAddress *aExtAddresses,
+                                         uint16_t            aNumEntries,
+                                         uint16_t           *aNumAdded);
+
 /**
  * Get the radio supported channel mask that the device is allowed to be on.
  *
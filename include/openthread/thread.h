@@ -954,6 +954,9 @@ uint32_t otThreadGetMaxTimeInQueue(otInstance *aInstance);
  *
  * Requires `OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_ENABLE`.
  *
+ * Also resets the address resolution statistics (`otThreadGetMaxResolvingQueueLength()` and
+ * `otThreadGetMaxAddressResolvingTime()`) on an FTD.
+ *
  * @param[in]  aInstance      A pointer to an OpenThread instance.
  *
  */
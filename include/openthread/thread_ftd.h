@@ -920,6 +920,40 @@ void otThreadGetNextHopAndPathCost(otInstance *aInstance,
                                    uint16_t   *aNextHopRloc16,
                                    uint8_t    *aPathCost);
 
+/**
+ * Gets the maximum number of messages held at the same time waiting for address resolution.
+ *
+ * Requires `OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_ENABLE`.
+ *
+ * Messages whose destination is being resolved are held outside of the TX queue until the address resolution
+ * completes.
+ *
+ * The collected statistics can be reset by calling `otThreadResetTimeInQueueStat()`.
+ *
+ * @param[in]  aInstance      A pointer to an OpenThread instance.
+ *
+ * @returns The maximum number of messages waiting for address resolution (so far).
+ *
+ */
+uint16_t otThreadGetMaxResolvingQueueLength(otInstance *aInstance);
+
+/**
+ * Gets the maximum time a message was held waiting for address resolution.
+ *
+ * Requires `OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_ENABLE`.
+ *
+ * The time is measured as the duration from when a message is added to the TX queue until the address resolution of
+ * its destination completes (successfully or not).
+ *
+ * The collected statistics can be reset by calling `otThreadResetTimeInQueueStat()`.
+ *
+ * @param[in]  aInstance      A pointer to an OpenThread instance.
+ *
+ * @returns The maximum address resolution time in milliseconds (so far).
+ *
+ */
+uint32_t otThreadGetMaxAddressResolvingTime(otInstance *aInstance);
+
 /**
  * @}
  *
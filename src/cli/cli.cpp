@@ -7549,6 +7549,28 @@ template <> otError Interpreter::Process<Cmd("timeinqueue")>(Arg aArgs[])
     {
         OutputLine("%lu", ToUlong(otThreadGetMaxTimeInQueue(GetInstancePtr())));
     }
+#if OPENTHREAD_FTD
+    /**
+     * @cli timeinqueue resolving
+     * @code
+     * timeinqueue resolving
+     * Max queue length: 3
+     * Max resolving time: 1530
+     * Done
+     * @endcode
+     * @par
+     * Gets the maximum number of messages held waiting for address resolution, and the maximum time in milliseconds
+     * a message was held waiting for address resolution.
+     * @sa otThreadGetMaxResolvingQueueLength
+     * @sa otThreadGetMaxAddressResolvingTime
+     * @csa{timeinqueue reset}
+     */
+    else if (aArgs[0] == "resolving")
+    {
+        OutputLine("Max queue length: %u", otThreadGetMaxResolvingQueueLength(GetInstancePtr()));
+        OutputLine("Max resolving time: %lu", ToUlong(otThreadGetMaxAddressResolvingTime(GetInstancePtr())));
+    }
+#endif
     /**
      * @cli timeinqueue reset
      * @code
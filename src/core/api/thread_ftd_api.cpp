@@ -426,4 +426,16 @@ void otThreadGetNextHopAndPathCost(otInstance *aInstance,
         (aPathCost != nullptr) ? *aPathCost : pathcost);
 }
 
+#if OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_ENABLE
+uint16_t otThreadGetMaxResolvingQueueLength(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<MeshForwarder>().GetMaxResolvingQueueLength();
+}
+
+uint32_t otThreadGetMaxAddressResolvingTime(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<MeshForwarder>().GetMaxResolvingInterval();
+}
+#endif
+
 #endif // OPENTHREAD_FTD
@@ -1009,6 +1009,31 @@ Message *CoapBase::FindRelatedRequest(const Message          &aResponse,
 
     for (Message &message : mPendingRequests)
     {
+        bool isCandidate = false;
+
+        // The Message ID and token are kept in the head buffer of
+        // the message, so they are checked first. The metadata
+        // appended at the end of the message is read only for a
+        // candidate request.
+
+        switch (aResponse.GetType())
+        {
+        case kTypeReset:
+        case kTypeAck:
+            isCandidate = (aResponse.GetMessageId() == message.GetMessageId());
+            break;
+
+        case kTypeConfirmable:
+        case kTypeNonConfirmable:
+            isCandidate = aResponse.IsTokenEqual(message);
+            break;
+        }
+
+        if (!isCandidate)
+        {
+            continue;
+        }
+
         aMetadata.ReadFrom(message);
 
         if (((aMetadata.mDestinationAddress == aMessageInfo.GetPeerAddr()) ||
@@ -1016,32 +1041,11 @@ Message *CoapBase::FindRelatedRequest(const Message          &aResponse,
              aMetadata.mDestinationAddress.GetIid().IsAnycastLocator()) &&
             (aMetadata.mDestinationPort == aMessageInfo.GetPeerPort()))
         {
-            switch (aResponse.GetType())
-            {
-            case kTypeReset:
-            case kTypeAck:
-                if (aResponse.GetMessageId() == message.GetMessageId())
-                {
-                    request = &message;
-                    ExitNow();
-                }
-
-                break;
-
-            case kTypeConfirmable:
-            case kTypeNonConfirmable:
-                if (aResponse.IsTokenEqual(message))
-                {
-                    request = &message;
-                    ExitNow();
-                }
-
-                break;
-            }
+            request = &message;
+            break;
         }
     }
 
-exit:
     return request;
 }
 
@@ -1485,64 +1489,60 @@ Error ResponsesQueue::GetMatchedResponseCopy(const Message          &aRequest,
                                              const Ip6::MessageInfo &aMessageInfo,
                                              Message               **aResponse)
 {
-    Error          error = kErrorNone;
-    const Message *cacheResponse;
+    Error        error = kErrorNone;
+    const Entry *entry;
 
-    cacheResponse = FindMatchedResponse(aRequest, aMessageInfo);
-    VerifyOrExit(cacheResponse != nullptr, error = kErrorNotFound);
+    entry = FindMatchedEntry(aRequest, aMessageInfo);
+    VerifyOrExit(entry != nullptr, error = kErrorNotFound);
 
-    *aResponse = cacheResponse->Clone(cacheResponse->GetLength() - sizeof(ResponseMetadata));
+    *aResponse = entry->mMessage->Clone();
     VerifyOrExit(*aResponse != nullptr, error = kErrorNoBufs);
 
 exit:
     return error;
 }
 
-const Message *ResponsesQueue::FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const
+const ResponsesQueue::Entry *ResponsesQueue::FindMatchedEntry(const Message          &aRequest,
+                                                              const Ip6::MessageInfo &aMessageInfo) const
 {
-    const Message *response = nullptr;
+    const Entry *match     = nullptr;
+    uint16_t     messageId = aRequest.GetMessageId();
 
-    for (const Message &message : mQueue)
+    for (const Entry &entry : mEntries)
     {
-        if (message.GetMessageId() == aRequest.GetMessageId())
+        if (entry.Matches(messageId, aMessageInfo))
         {
-            ResponseMetadata metadata;
-
-            metadata.ReadFrom(message);
-
-            if ((metadata.mMessageInfo.GetPeerPort() == aMessageInfo.GetPeerPort()) &&
-                (metadata.mMessageInfo.GetPeerAddr() == aMessageInfo.GetPeerAddr()))
-            {
-                response = &message;
-                break;
-            }
+            match = &entry;
+            break;
         }
     }
 
-    return response;
+    return match;
 }
 
 void ResponsesQueue::EnqueueResponse(Message                &aMessage,
                                      const Ip6::MessageInfo &aMessageInfo,
                                      const TxParameters     &aTxParameters)
 {
-    Message         *responseCopy;
-    ResponseMetadata metadata;
-
-    metadata.mDequeueTime = TimerMilli::GetNow() + aTxParameters.CalculateExchangeLifetime();
-    metadata.mMessageInfo = aMessageInfo;
+    Message *responseCopy;
+    Entry    entry;
 
-    VerifyOrExit(FindMatchedResponse(aMessage, aMessageInfo) == nullptr);
+    VerifyOrExit(FindMatchedEntry(aMessage, aMessageInfo) == nullptr);
 
     UpdateQueue();
 
     VerifyOrExit((responseCopy = aMessage.Clone()) != nullptr);
 
-    VerifyOrExit(metadata.AppendTo(*responseCopy) == kErrorNone, responseCopy->Free());
+    entry.mMessage     = responseCopy;
+    entry.mDequeueTime = TimerMilli::GetNow() + aTxParameters.CalculateExchangeLifetime();
+    entry.mPeerAddr    = aMessageInfo.GetPeerAddr();
+    entry.mPeerPort    = aMessageInfo.GetPeerPort();
+    entry.mMessageId   = aMessage.GetMessageId();
 
+    SuccessOrAssert(mEntries.PushBack(entry));
     mQueue.Enqueue(*responseCopy);
 
-    mTimer.FireAtIfEarlier(metadata.mDequeueTime);
+    mTimer.FireAtIfEarlier(entry.mDequeueTime);
 
 exit:
     return;
@@ -1550,38 +1550,38 @@ exit:
 
 void ResponsesQueue::UpdateQueue(void)
 {
-    uint16_t  msgCount    = 0;
-    Message  *earliestMsg = nullptr;
-    TimeMilli earliestDequeueTime(0);
+    Entry *earliest = nullptr;
 
-    // Check the number of messages in the queue and if number is at
-    // `kMaxCachedResponses` remove the one with earliest dequeue
-    // time.
+    // If the number of cached responses is at `kMaxCachedResponses`
+    // remove the one with earliest dequeue time.
 
-    for (Message &message : mQueue)
-    {
-        ResponseMetadata metadata;
+    VerifyOrExit(mEntries.IsFull());
 
-        metadata.ReadFrom(message);
-
-        if ((earliestMsg == nullptr) || (metadata.mDequeueTime < earliestDequeueTime))
+    for (Entry &entry : mEntries)
+    {
+        if ((earliest == nullptr) || (entry.mDequeueTime < earliest->mDequeueTime))
         {
-            earliestMsg         = &message;
-            earliestDequeueTime = metadata.mDequeueTime;
+            earliest = &entry;
         }
-
-        msgCount++;
     }
 
-    if (msgCount >= kMaxCachedResponses)
-    {
-        DequeueResponse(*earliestMsg);
-    }
+    RemoveEntry(*earliest);
+
+exit:
+    return;
 }
 
-void ResponsesQueue::DequeueResponse(Message &aMessage) { mQueue.DequeueAndFree(aMessage); }
+void ResponsesQueue::RemoveEntry(Entry &aEntry)
+{
+    mQueue.DequeueAndFree(*aEntry.mMessage);
+    mEntries.Remove(aEntry);
+}
 
-void ResponsesQueue::DequeueAllResponses(void) { mQueue.DequeueAndFreeAll(); }
+void ResponsesQueue::DequeueAllResponses(void)
+{
+    mQueue.DequeueAndFreeAll();
+    mEntries.Clear();
+}
 
 void ResponsesQueue::HandleTimer(Timer &aTimer)
 {
@@ -1593,19 +1593,20 @@ void ResponsesQueue::HandleTimer(void)
     TimeMilli now             = TimerMilli::GetNow();
     TimeMilli nextDequeueTime = now.GetDistantFuture();
 
-    for (Message &message : mQueue)
+    for (uint16_t index = 0; index < mEntries.GetLength();)
     {
-        ResponseMetadata metadata;
+        Entry &entry = mEntries[index];
 
-        metadata.ReadFrom(message);
-
-        if (now >= metadata.mDequeueTime)
+        if (now >= entry.mDequeueTime)
         {
-            DequeueResponse(message);
+            // `Remove()` moves the last entry into this slot, so
+            // the same index is checked again.
+            RemoveEntry(entry);
             continue;
         }
 
-        nextDequeueTime = Min(nextDequeueTime, metadata.mDequeueTime);
+        nextDequeueTime = Min(nextDequeueTime, entry.mDequeueTime);
+        index++;
     }
 
     if (nextDequeueTime < now.GetDistantFuture())
@@ -1614,12 +1615,10 @@ void ResponsesQueue::HandleTimer(void)
     }
 }
 
-void ResponsesQueue::ResponseMetadata::ReadFrom(const Message &aMessage)
+bool ResponsesQueue::Entry::Matches(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo) const
 {
-    uint16_t length = aMessage.GetLength();
-
-    OT_ASSERT(length >= sizeof(*this));
-    IgnoreError(aMessage.Read(length - sizeof(*this), *this));
+    return (mMessageId == aMessageId) && (mPeerPort == aMessageInfo.GetPeerPort()) &&
+           (mPeerAddr == aMessageInfo.GetPeerAddr());
 }
 
 /// Return product of @p aValueA and @p aValueB if no overflow otherwise 0.
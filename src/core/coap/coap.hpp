@@ -34,6 +34,7 @@
 #include <openthread/coap.h>
 
 #include "coap/coap_message.hpp"
+#include "common/array.hpp"
 #include "common/as_core_type.hpp"
 #include "common/callback.hpp"
 #include "common/debug.hpp"
@@ -337,24 +338,32 @@ public:
 private:
     static constexpr uint16_t kMaxCachedResponses = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES;
 
-    struct ResponseMetadata
+    // Each cached response in `mQueue` has a matching entry in
+    // `mEntries` which holds its lookup key (Message ID and peer
+    // endpoint) and dequeue time, so that searching the cache does
+    // not need to read anything from the messages.
+
+    struct Entry
     {
-        Error AppendTo(Message &aMessage) const { return aMessage.Append(*this); }
-        void  ReadFrom(const Message &aMessage);
+        bool Matches(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo) const;
 
-        TimeMilli        mDequeueTime;
-        Ip6::MessageInfo mMessageInfo;
+        Message     *mMessage;
+        TimeMilli    mDequeueTime;
+        Ip6::Address mPeerAddr;
+        uint16_t     mPeerPort;
+        uint16_t     mMessageId;
     };
 
-    const Message *FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const;
-    void           DequeueResponse(Message &aMessage);
-    void           UpdateQueue(void);
+    const Entry *FindMatchedEntry(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const;
+    void         RemoveEntry(Entry &aEntry);
+    void         UpdateQueue(void);
 
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
 
-    MessageQueue      mQueue;
-    TimerMilliContext mTimer;
+    MessageQueue                      mQueue;
+    Array<Entry, kMaxCachedResponses> mEntries;
+    TimerMilliContext                 mTimer;
 };
 
 /**
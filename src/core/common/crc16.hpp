@@ -75,6 +75,15 @@ public:
      */
     void Update(uint8_t aByte);
 
+    /**
+     * Feeds a given data buffer into the CRC16 computation.
+     *
+     * @param[in]  aData    A pointer to the data buffer.
+     * @param[in]  aLength  The data length (number of bytes).
+     *
+     */
+    void Update(const uint8_t *aData, uint16_t aLength);
+
     /**
      * Gets the current CRC16 value.
      *
@@ -84,8 +93,15 @@ public:
     uint16_t Get(void) const { return mCrc; }
 
 private:
-    uint16_t mPolynomial;
-    uint16_t mCrc;
+    static constexpr uint8_t kTableSize = 16;
+
+    static const uint16_t kCcittTable[kTableSize];
+    static const uint16_t kAnsiTable[kTableSize];
+
+    void UpdateNibble(uint8_t aNibble);
+
+    const uint16_t *mTable;
+    uint16_t        mCrc;
 };
 
 } // namespace ot
@@ -411,6 +411,9 @@ void Instance::GetBufferInfo(BufferInfo &aInfo)
     aInfo.mMaxUsedBuffers = Get<MessagePool>().GetMaxUsedBufferCount();
 
     Get<MeshForwarder>().GetSendQueue().GetInfo(aInfo.m6loSendQueue);
+#if OPENTHREAD_FTD
+    Get<MeshForwarder>().GetResolvingQueue().GetInfo(aInfo.m6loSendQueue);
+#endif
     Get<MeshForwarder>().GetReassemblyQueue().GetInfo(aInfo.m6loReassemblyQueue);
     Get<Ip6::Ip6>().GetSendQueue().GetInfo(aInfo.mIp6Queue);
 
@@ -139,6 +139,38 @@ exit:
     return buffer;
 }
 
+Buffer *MessagePool::NewBuffers(Message::Priority aPriority, uint16_t aNumBuffers)
+{
+    Buffer *head = nullptr;
+    Buffer *tail = nullptr;
+
+    for (; aNumBuffers > 0; aNumBuffers--)
+    {
+        Buffer *buffer = NewBuffer(aPriority);
+
+        if (buffer == nullptr)
+        {
+            FreeBuffers(head);
+            head = nullptr;
+            ExitNow();
+        }
+
+        if (tail == nullptr)
+        {
+            head = buffer;
+        }
+        else
+        {
+            tail->SetNextBuffer(buffer);
+        }
+
+        tail = buffer;
+    }
+
+exit:
+    return head;
+}
+
 void MessagePool::FreeBuffers(Buffer *aBuffer)
 {
     while (aBuffer != nullptr)
@@ -233,18 +265,29 @@ Error Message::ResizeMessage(uint16_t aLength)
     Buffer  *lastBuffer;
     uint16_t curLength = kHeadBufferDataSize;
 
-    while (curLength < aLength)
+    while ((curLength < aLength) && (curBuffer->GetNextBuffer() != nullptr))
     {
-        if (curBuffer->GetNextBuffer() == nullptr)
-        {
-            curBuffer->SetNextBuffer(GetMessagePool()->NewBuffer(GetPriority()));
-            VerifyOrExit(curBuffer->GetNextBuffer() != nullptr, error = kErrorNoBufs);
-        }
-
         curBuffer = curBuffer->GetNextBuffer();
         curLength += kBufferDataSize;
     }
 
+    if (curLength < aLength)
+    {
+        // Allocate all the missing buffers as one chain, so that on
+        // failure the message is left unchanged.
+
+        uint16_t numBuffers = static_cast<uint16_t>((aLength - curLength + kBufferDataSize - 1) / kBufferDataSize);
+
+        curBuffer->SetNextBuffer(GetMessagePool()->NewBuffers(GetPriority(), numBuffers));
+        VerifyOrExit(curBuffer->GetNextBuffer() != nullptr, error = kErrorNoBufs);
+
+        while (curLength < aLength)
+        {
+            curBuffer = curBuffer->GetNextBuffer();
+            curLength += kBufferDataSize;
+        }
+    }
+
     lastBuffer = curBuffer;
     curBuffer  = curBuffer->GetNextBuffer();
     lastBuffer->SetNextBuffer(nullptr);
@@ -414,19 +457,14 @@ Error Message::AppendBytesFromMessage(const Message &aMessage, uint16_t aOffset,
 {
     Error    error       = kErrorNone;
     uint16_t writeOffset = GetLength();
-    Chunk    chunk;
 
     VerifyOrExit(aMessage.GetLength() >= aOffset + aLength, error = kErrorParse);
     SuccessOrExit(error = SetLength(GetLength() + aLength));
 
-    aMessage.GetFirstChunk(aOffset, aLength, chunk);
+    // The appended range never overlaps the read range, even when
+    // `aMessage` is this message itself.
 
-    while (chunk.GetLength() > 0)
-    {
-        WriteBytes(writeOffset, chunk.GetBytes(), chunk.GetLength());
-        writeOffset += chunk.GetLength();
-        aMessage.GetNextChunk(aLength, chunk);
-    }
+    CopyChunksFromMessage(writeOffset, aMessage, aOffset, aLength);
 
 exit:
     return error;
@@ -717,16 +755,7 @@ void Message::WriteBytesFromMessage(uint16_t       aWriteOffset,
 {
     if ((&aMessage != this) || (aReadOffset >= aWriteOffset))
     {
-        Chunk chunk;
-
-        aMessage.GetFirstChunk(aReadOffset, aLength, chunk);
-
-        while (chunk.GetLength() > 0)
-        {
-            WriteBytes(aWriteOffset, chunk.GetBytes(), chunk.GetLength());
-            aWriteOffset += chunk.GetLength();
-            aMessage.GetNextChunk(aLength, chunk);
-        }
+        CopyChunksFromMessage(aWriteOffset, aMessage, aReadOffset, aLength);
     }
     else
     {
@@ -755,6 +784,52 @@ void Message::WriteBytesFromMessage(uint16_t       aWriteOffset,
     }
 }
 
+void Message::CopyChunksFromMessage(uint16_t       aWriteOffset,
+                                    const Message &aMessage,
+                                    uint16_t       aReadOffset,
+                                    uint16_t       aLength)
+{
+    // This method copies bytes from `aMessage` walking the read and
+    // write chunks in lock-step, so that each buffer chain is only
+    // traversed once. The caller MUST ensure that the read range
+    // does not overlap the write range at a lower offset.
+
+    uint16_t     readLength  = aLength;
+    uint16_t     writeLength = aLength;
+    Chunk        readChunk;
+    MutableChunk writeChunk;
+
+    OT_ASSERT(aWriteOffset + aLength <= GetLength());
+
+    aMessage.GetFirstChunk(aReadOffset, readLength, readChunk);
+    GetFirstChunk(aWriteOffset, writeLength, writeChunk);
+
+    while ((readChunk.GetLength() > 0) && (writeChunk.GetLength() > 0))
+    {
+        uint16_t copyLength = Min(readChunk.GetLength(), writeChunk.GetLength());
+
+        memmove(writeChunk.GetBytes(), readChunk.GetBytes(), copyLength);
+
+        if (copyLength == readChunk.GetLength())
+        {
+            aMessage.GetNextChunk(readLength, readChunk);
+        }
+        else
+        {
+            readChunk.Init(readChunk.GetBytes() + copyLength, readChunk.GetLength() - copyLength);
+        }
+
+        if (copyLength == writeChunk.GetLength())
+        {
+            GetNextChunk(writeLength, writeChunk);
+        }
+        else
+        {
+            writeChunk.Init(writeChunk.GetBytes() + copyLength, writeChunk.GetLength() - copyLength);
+        }
+    }
+}
+
 Message *Message::Clone(uint16_t aLength) const
 {
     Error    error = kErrorNone;
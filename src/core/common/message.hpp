@@ -1420,6 +1420,7 @@ private:
     static const Message *NextOf(const Message *aMessage) { return (aMessage != nullptr) ? aMessage->Next() : nullptr; }
 
     Error ResizeMessage(uint16_t aLength);
+    void  CopyChunksFromMessage(uint16_t aWriteOffset, const Message &aMessage, uint16_t aReadOffset, uint16_t aLength);
 };
 
 /**
@@ -1776,6 +1777,7 @@ public:
 
 private:
     Buffer *NewBuffer(Message::Priority aPriority);
+    Buffer *NewBuffers(Message::Priority aPriority, uint16_t aNumBuffers);
     void    FreeBuffers(Buffer *aBuffer);
     Error   ReclaimBuffers(Message::Priority aPriority);
 
@@ -103,6 +103,216 @@ void TimerMilli::Stop(void) { Get<Scheduler>().Remove(*this); }
 
 void TimerMilli::RemoveAll(Instance &aInstance) { aInstance.Get<Scheduler>().RemoveAll(); }
 
+#if OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+
+bool Timer::Scheduler::IsBefore(const Timer &aFirst, const Timer &aSecond, Time aNow)
+{
+    // Timers with the same fire time are ordered by when they were
+    // started, so that they fire in the same (FIFO) order as with
+    // the sorted list. The sequence numbers are compared as a signed
+    // difference, which stays correct across a wrap of the counter.
+
+    bool retval;
+
+    if (aFirst.GetFireTime() == aSecond.GetFireTime())
+    {
+        retval = static_cast<int32_t>(aFirst.mSequence - aSecond.mSequence) < 0;
+    }
+    else
+    {
+        retval = aFirst.DoesFireBefore(aSecond, aNow);
+    }
+
+    return retval;
+}
+
+Timer *Timer::Scheduler::Meld(Timer &aFirst, Timer &aSecond, Time aNow)
+{
+    // Melds two heap-ordered trees (whose roots have no siblings) by
+    // making the root that fires later the first child of the other
+    // one. Returns the new root.
+
+    Timer *parent = &aFirst;
+    Timer *child  = &aSecond;
+
+    if (IsBefore(aSecond, aFirst, aNow))
+    {
+        parent = &aSecond;
+        child  = &aFirst;
+    }
+
+    child->mPrev = parent;
+    child->SetNext(parent->mChild);
+
+    if (parent->mChild != nullptr)
+    {
+        parent->mChild->mPrev = child;
+    }
+
+    parent->mChild = child;
+    parent->mPrev  = nullptr;
+    parent->SetNext(nullptr);
+
+    return parent;
+}
+
+Timer *Timer::Scheduler::MergePairs(Timer *aFirst, Time aNow)
+{
+    // Merges a list of sibling trees into a single tree using the
+    // standard two-pass pairing. The first pass melds the siblings in
+    // pairs from left to right (collecting the results in reverse
+    // order), the second pass melds the results into one tree.
+
+    Timer *pairs = nullptr;
+    Timer *root  = nullptr;
+
+    while (aFirst != nullptr)
+    {
+        Timer *first  = aFirst;
+        Timer *second = first->GetNext();
+        Timer *melded;
+
+        if (second == nullptr)
+        {
+            aFirst       = nullptr;
+            first->mPrev = nullptr;
+            melded       = first;
+        }
+        else
+        {
+            aFirst = second->GetNext();
+            melded = Meld(*first, *second, aNow);
+        }
+
+        melded->SetNext(pairs);
+        pairs = melded;
+    }
+
+    while (pairs != nullptr)
+    {
+        Timer *next = pairs->GetNext();
+
+        pairs->SetNext(nullptr);
+        root  = (root == nullptr) ? pairs : Meld(*root, *pairs, aNow);
+        pairs = next;
+    }
+
+    return root;
+}
+
+void Timer::Scheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    Time now(aAlarmApi.AlarmGetNow());
+
+    Remove(aTimer, aAlarmApi);
+
+    aTimer.mChild    = nullptr;
+    aTimer.mPrev     = nullptr;
+    aTimer.mSequence = mNextSequence++;
+    aTimer.SetNext(nullptr);
+
+    mHeapRoot = (mHeapRoot == nullptr) ? &aTimer : Meld(*mHeapRoot, aTimer, now);
+
+    if (mHeapRoot == &aTimer)
+    {
+        SetAlarm(aAlarmApi);
+    }
+}
+
+void Timer::Scheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    Time   now;
+    Timer *subHeap;
+
+    VerifyOrExit(aTimer.IsRunning());
+
+    now.SetValue(aAlarmApi.AlarmGetNow());
+    subHeap = MergePairs(aTimer.mChild, now);
+
+    if (mHeapRoot == &aTimer)
+    {
+        mHeapRoot = subHeap;
+        SetAlarm(aAlarmApi);
+    }
+    else
+    {
+        Timer *prev = aTimer.mPrev;
+        Timer *next = aTimer.GetNext();
+
+        if (prev->mChild == &aTimer)
+        {
+            prev->mChild = next;
+        }
+        else
+        {
+            prev->SetNext(next);
+        }
+
+        if (next != nullptr)
+        {
+            next->mPrev = prev;
+        }
+
+        if (subHeap != nullptr)
+        {
+            Timer *oldRoot = mHeapRoot;
+
+            mHeapRoot = Meld(*mHeapRoot, *subHeap, now);
+
+            if (mHeapRoot != oldRoot)
+            {
+                SetAlarm(aAlarmApi);
+            }
+        }
+    }
+
+    aTimer.mChild = nullptr;
+    aTimer.mPrev  = nullptr;
+    aTimer.SetNext(&aTimer);
+
+exit:
+    return;
+}
+
+void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
+{
+    // Walks the heap using `mNext` to chain the nodes still to be
+    // visited, prepending the children of each visited node.
+
+    Timer *timer = mHeapRoot;
+
+    mHeapRoot = nullptr;
+
+    while (timer != nullptr)
+    {
+        Timer *next  = timer->GetNext();
+        Timer *child = timer->mChild;
+
+        if (child != nullptr)
+        {
+            Timer *last = child;
+
+            while (last->GetNext() != nullptr)
+            {
+                last = last->GetNext();
+            }
+
+            last->SetNext(next);
+            next = child;
+        }
+
+        timer->mChild = nullptr;
+        timer->mPrev  = nullptr;
+        timer->SetNext(timer);
+
+        timer = next;
+    }
+
+    SetAlarm(aAlarmApi);
+}
+
+#else // OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+
 void Timer::Scheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
 {
     Timer *prev = nullptr;
@@ -151,15 +361,29 @@ exit:
     return;
 }
 
+void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
+{
+    Timer *timer;
+
+    while ((timer = mTimerList.Pop()) != nullptr)
+    {
+        timer->SetNext(timer);
+    }
+
+    SetAlarm(aAlarmApi);
+}
+
+#endif // OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+
 void Timer::Scheduler::SetAlarm(const AlarmApi &aAlarmApi)
 {
-    if (mTimerList.IsEmpty())
+    if (GetHead() == nullptr)
     {
         aAlarmApi.AlarmStop(&GetInstance());
     }
     else
     {
-        Timer   *timer = mTimerList.GetHead();
+        Timer   *timer = GetHead();
         Time     now(aAlarmApi.AlarmGetNow());
         uint32_t remaining;
 
@@ -171,7 +395,7 @@ void Timer::Scheduler::SetAlarm(const AlarmApi &aAlarmApi)
 
 void Timer::Scheduler::ProcessTimers(const AlarmApi &aAlarmApi)
 {
-    Timer *timer = mTimerList.GetHead();
+    Timer *timer = GetHead();
 
     if (timer)
     {
@@ -191,18 +415,6 @@ exit:
     return;
 }
 
-void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
-{
-    Timer *timer;
-
-    while ((timer = mTimerList.Pop()) != nullptr)
-    {
-        timer->SetNext(timer);
-    }
-
-    SetAlarm(aAlarmApi);
-}
-
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance)
 {
     VerifyOrExit(otInstanceIsInitialized(aInstance));
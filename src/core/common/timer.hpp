@@ -116,6 +116,10 @@ protected:
 
         explicit Scheduler(Instance &aInstance)
             : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+            , mHeapRoot(nullptr)
+            , mNextSequence(0)
+#endif
         {
         }
 
@@ -125,13 +129,30 @@ protected:
         void ProcessTimers(const AlarmApi &aAlarmApi);
         void SetAlarm(const AlarmApi &aAlarmApi);
 
+#if OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+        Timer        *GetHead(void) { return mHeapRoot; }
+        static bool   IsBefore(const Timer &aFirst, const Timer &aSecond, Time aNow);
+        static Timer *Meld(Timer &aFirst, Timer &aSecond, Time aNow);
+        static Timer *MergePairs(Timer *aFirst, Time aNow);
+
+        Timer   *mHeapRoot;
+        uint32_t mNextSequence;
+#else
+        Timer *GetHead(void) { return mTimerList.GetHead(); }
+
         LinkedList<Timer> mTimerList;
+#endif
     };
 
     Timer(Instance &aInstance, Handler aHandler)
         : InstanceLocator(aInstance)
         , mHandler(aHandler)
         , mNext(this)
+#if OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+        , mChild(nullptr)
+        , mPrev(nullptr)
+        , mSequence(0)
+#endif
     {
     }
 
@@ -141,6 +162,15 @@ protected:
     Handler mHandler;
     Time    mFireTime;
     Timer  *mNext;
+#if OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+    // In a pairing heap, `mNext` points to the next sibling, `mChild`
+    // to the first child and `mPrev` to the previous sibling (or to
+    // the parent for a first child). `mSequence` orders the timers
+    // with the same fire time by when they were started.
+    Timer   *mChild;
+    Timer   *mPrev;
+    uint32_t mSequence;
+#endif
 };
 
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance);
@@ -51,6 +51,17 @@
 /** Use platform provided crypto library */
 #define OPENTHREAD_CONFIG_CRYPTO_LIB_PLATFORM 2
 
+/**
+ * @def OPENTHREAD_CONFIG_AES_CCM_BLOCK_PROCESSING_ENABLE
+ *
+ * Define to 1 to have `AesCcm` process header and payload data a whole AES block at a time whenever the data is
+ * block aligned. Partial blocks (e.g., at the boundaries of message chunks) are still processed byte by byte.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_AES_CCM_BLOCK_PROCESSING_ENABLE
+#define OPENTHREAD_CONFIG_AES_CCM_BLOCK_PROCESSING_ENABLE 1
+#endif
+
 #if OPENTHREAD_CONFIG_CRYPTO_LIB == OPENTHREAD_CONFIG_CRYPTO_LIB_PLATFORM
 
 /**
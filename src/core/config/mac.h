@@ -365,6 +365,19 @@
 #define OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_SECURITY_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+ *
+ * Define to 1 to keep AES-CCM contexts keyed with the previous, current and next MAC keys in `SubMac`, so that the
+ * AES key expansion is done once per key change instead of once per secured frame (tx, rx and enhanced ack).
+ *
+ * This costs three AES-CCM contexts of RAM and is not supported along with platform key references.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_TIMING_ENABLE
  *
@@ -62,6 +62,23 @@
 #define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_NUM_ENTRIES
+ *
+ * The number of entries in the table indexing the 6LoWPAN datagrams under reassembly.
+ *
+ * Every datagram under reassembly holds at least one message buffer, so by default the table is sized from the
+ * message buffer pool and the number of concurrent reassemblies is only limited by the available buffers. When
+ * message buffers run out, the oldest datagram of the neighbor holding the most reassembly buffers is dropped.
+ *
+ * The oldest datagram is also dropped if the table itself is full, which can only happen if the message buffers are
+ * allocated from the heap or by the platform.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_NUM_ENTRIES
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_NUM_ENTRIES OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NUM_FRAGMENT_PRIORITY_ENTRIES
  *
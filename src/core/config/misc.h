@@ -121,6 +121,22 @@
 #define OPENTHREAD_CONFIG_UPTIME_ENABLE OPENTHREAD_FTD
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+ *
+ * Define to 1 for the timer schedulers (`TimerMilli` and `TimerMicro`) to keep the running timers in a pairing heap
+ * instead of a sorted linked list.
+ *
+ * With a sorted list, starting a timer is O(n) in the number of running timers. A pairing heap makes starting a timer
+ * O(1) and stopping or firing a timer O(log n) (amortized) at the cost of two extra pointers and a sequence number in
+ * every `Timer`. This is intended for devices running many timers simultaneously (e.g., an FTD with many children). As
+ * with the sorted list, timers with the same fire time fire in the order they were started.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+#define OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_JAM_DETECTION_ENABLE
  *
@@ -161,11 +161,12 @@ void AesCcm::Init(uint32_t    aHeaderLength,
 void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
 {
     const uint8_t *headerBytes = reinterpret_cast<const uint8_t *>(aHeader);
+    uint32_t       i           = 0;
 
     OT_ASSERT(mHeaderCur + aHeaderLength <= mHeaderLength);
 
     // process header
-    for (unsigned i = 0; i < aHeaderLength; i++)
+    while (i < aHeaderLength)
     {
         if (mBlockLength == sizeof(mBlock))
         {
@@ -173,7 +174,21 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
             mBlockLength = 0;
         }
 
-        mBlock[mBlockLength++] ^= headerBytes[i];
+#if OPENTHREAD_CONFIG_AES_CCM_BLOCK_PROCESSING_ENABLE
+        if ((mBlockLength == 0) && (aHeaderLength - i >= sizeof(mBlock)))
+        {
+            for (uint8_t j = 0; j < sizeof(mBlock); j++)
+            {
+                mBlock[j] ^= headerBytes[i + j];
+            }
+
+            mBlockLength = sizeof(mBlock);
+            i += sizeof(mBlock);
+            continue;
+        }
+#endif
+
+        mBlock[mBlockLength++] ^= headerBytes[i++];
     }
 
     mHeaderCur += aHeaderLength;
@@ -190,29 +205,75 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
     }
 }
 
+void AesCcm::GenerateCtrPad(void)
+{
+    for (int j = sizeof(mCtr) - 1; j > mNonceLength; j--)
+    {
+        if (++mCtr[j])
+        {
+            break;
+        }
+    }
+
+    mEcb.Encrypt(mCtr, mCtrPad);
+    mCtrLength = 0;
+}
+
 void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode aMode)
 {
     uint8_t *plaintextBytes  = reinterpret_cast<uint8_t *>(aPlainText);
     uint8_t *ciphertextBytes = reinterpret_cast<uint8_t *>(aCipherText);
     uint8_t  byte;
+    uint32_t i = 0;
 
     OT_ASSERT(mPlainTextCur + aLength <= mPlainTextLength);
 
-    for (unsigned i = 0; i < aLength; i++)
+    while (i < aLength)
     {
-        if (mCtrLength == 16)
+        if (mCtrLength == sizeof(mCtrPad))
         {
-            for (int j = sizeof(mCtr) - 1; j > mNonceLength; j--)
+            GenerateCtrPad();
+        }
+
+        if (mBlockLength == sizeof(mBlock))
+        {
+            mEcb.Encrypt(mBlock, mBlock);
+            mBlockLength = 0;
+        }
+
+#if OPENTHREAD_CONFIG_AES_CCM_BLOCK_PROCESSING_ENABLE
+        // When both the counter pad and the CBC-MAC block are at a
+        // block boundary, a full block is processed in one go. The
+        // plaintext and ciphertext can be the same buffer, so each
+        // byte is read before it is written.
+
+        if ((mCtrLength == 0) && (mBlockLength == 0) && (aLength - i >= sizeof(mBlock)))
+        {
+            if (aMode == kEncrypt)
+            {
+                for (uint8_t j = 0; j < sizeof(mBlock); j++)
+                {
+                    byte                   = plaintextBytes[i + j];
+                    ciphertextBytes[i + j] = byte ^ mCtrPad[j];
+                    mBlock[j] ^= byte;
+                }
+            }
+            else
             {
-                if (++mCtr[j])
+                for (uint8_t j = 0; j < sizeof(mBlock); j++)
                 {
-                    break;
+                    byte                  = ciphertextBytes[i + j] ^ mCtrPad[j];
+                    plaintextBytes[i + j] = byte;
+                    mBlock[j] ^= byte;
                 }
             }
 
-            mEcb.Encrypt(mCtr, mCtrPad);
-            mCtrLength = 0;
+            mCtrLength   = sizeof(mCtrPad);
+            mBlockLength = sizeof(mBlock);
+            i += sizeof(mBlock);
+            continue;
         }
+#endif
 
         if (aMode == kEncrypt)
         {
@@ -225,13 +286,8 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
             plaintextBytes[i] = byte;
         }
 
-        if (mBlockLength == sizeof(mBlock))
-        {
-            mEcb.Encrypt(mBlock, mBlock);
-            mBlockLength = 0;
-        }
-
         mBlock[mBlockLength++] ^= byte;
+        i++;
     }
 
     mPlainTextCur += aLength;
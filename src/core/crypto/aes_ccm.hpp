@@ -199,6 +199,8 @@ public:
                               uint8_t               *aNonce);
 
 private:
+    void GenerateCtrPad(void);
+
     AesEcb   mEcb;
     uint8_t  mBlock[AesEcb::kBlockSize];
     uint8_t  mCtr[AesEcb::kBlockSize];
@@ -0,0 +1,54 @@
+#
+#  Copyright (c) 2026, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+
+# FTD core library with the pairing heap timer scheduler, used by the
+# unit tests to cover `OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE`.
+
+add_library(openthread-ftd-timer-heap)
+
+target_compile_definitions(openthread-ftd-timer-heap PRIVATE
+    OPENTHREAD_FTD=1
+    OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE=1
+)
+
+target_compile_options(openthread-ftd-timer-heap PRIVATE
+    ${OT_CFLAGS}
+)
+
+target_include_directories(openthread-ftd-timer-heap PUBLIC ${OT_PUBLIC_INCLUDES} PRIVATE ${COMMON_INCLUDES})
+
+target_sources(openthread-ftd-timer-heap PRIVATE ${COMMON_SOURCES})
+
+target_link_libraries(openthread-ftd-timer-heap
+    PRIVATE
+        ${OT_MBEDTLS}
+        ot-config-ftd
+        ot-config
+)
+
+target_link_libraries(openthread-ftd-timer-heap PRIVATE tcplp-ftd)
@@ -924,7 +924,7 @@ void Mac::ProcessTransmitSecurity(TxFrame &aFrame)
     VerifyOrExit(!aFrame.IsCslIePresent());
 #endif
 
-    aFrame.ProcessTransmitAesCcm(*extAddress);
+    ProcessTransmitAesCcm(aFrame, *extAddress);
 
 exit:
     return;
@@ -1502,6 +1502,42 @@ void Mac::HandleTimer(void)
     }
 }
 
+void Mac::ProcessTransmitAesCcm(TxFrame &aFrame, const ExtAddress &aExtAddress)
+{
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    Crypto::AesCcm *aesCcm = mLinks.GetSubMac().GetKeyedAesCcm(aFrame.GetAesKey());
+
+    if (aesCcm != nullptr)
+    {
+        aFrame.ProcessTransmitAesCcm(aExtAddress, *aesCcm);
+    }
+    else
+#endif
+    {
+        aFrame.ProcessTransmitAesCcm(aExtAddress);
+    }
+}
+
+Error Mac::ProcessReceiveAesCcm(RxFrame &aFrame, const ExtAddress &aExtAddress, const KeyMaterial &aMacKey)
+{
+    Error error;
+
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    Crypto::AesCcm *aesCcm = mLinks.GetSubMac().GetKeyedAesCcm(aMacKey);
+
+    if (aesCcm != nullptr)
+    {
+        error = aFrame.ProcessReceiveAesCcm(aExtAddress, *aesCcm);
+    }
+    else
+#endif
+    {
+        error = aFrame.ProcessReceiveAesCcm(aExtAddress, aMacKey);
+    }
+
+    return error;
+}
+
 Error Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neighbor *aNeighbor)
 {
     KeyManager        &keyManager = Get<KeyManager>();
@@ -1596,7 +1632,7 @@ Error Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neig
         ExitNow();
     }
 
-    SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, *macKey));
+    SuccessOrExit(ProcessReceiveAesCcm(aFrame, *extAddress, *macKey));
 
     if ((keyIdMode == Frame::kKeyIdMode1) && aNeighbor->IsStateValid())
     {
@@ -1717,7 +1753,7 @@ Error Mac::ProcessEnhAckSecurity(TxFrame &aTxFrame, RxFrame &aAckFrame)
         VerifyOrExit(frameCounter >= neighbor->GetLinkAckFrameCounter());
     }
 
-    error = aAckFrame.ProcessReceiveAesCcm(srcAddr.GetExtended(), *macKey);
+    error = ProcessReceiveAesCcm(aAckFrame, srcAddr.GetExtended(), *macKey);
     SuccessOrExit(error);
 
     if (neighbor->IsStateValid())
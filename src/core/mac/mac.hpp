@@ -765,6 +765,8 @@ private:
 
     Error ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neighbor *aNeighbor);
     void  ProcessTransmitSecurity(TxFrame &aFrame);
+    Error ProcessReceiveAesCcm(RxFrame &aFrame, const ExtAddress &aExtAddress, const KeyMaterial &aMacKey);
+    void  ProcessTransmitAesCcm(TxFrame &aFrame, const ExtAddress &aExtAddress);
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
     Error ProcessEnhAckSecurity(TxFrame &aTxFrame, RxFrame &aAckFrame);
 #endif
@@ -1357,26 +1357,42 @@ void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress)
 #if OPENTHREAD_RADIO && !OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_SECURITY_ENABLE
     OT_UNUSED_VARIABLE(aExtAddress);
 #else
-    uint32_t       frameCounter = 0;
-    uint8_t        securityLevel;
-    uint8_t        nonce[Crypto::AesCcm::kNonceSize];
-    uint8_t        tagLength;
     Crypto::AesCcm aesCcm;
 
     VerifyOrExit(GetSecurityEnabled());
 
+    aesCcm.SetKey(GetAesKey());
+    ProcessTransmitAesCcm(aExtAddress, aesCcm);
+
+exit:
+    return;
+#endif // OPENTHREAD_RADIO && !OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_SECURITY_ENABLE
+}
+
+void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress, Crypto::AesCcm &aAesCcm)
+{
+#if OPENTHREAD_RADIO && !OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_SECURITY_ENABLE
+    OT_UNUSED_VARIABLE(aExtAddress);
+    OT_UNUSED_VARIABLE(aAesCcm);
+#else
+    uint32_t frameCounter = 0;
+    uint8_t  securityLevel;
+    uint8_t  nonce[Crypto::AesCcm::kNonceSize];
+    uint8_t  tagLength;
+
+    VerifyOrExit(GetSecurityEnabled());
+
     SuccessOrExit(GetSecurityLevel(securityLevel));
     SuccessOrExit(GetFrameCounter(frameCounter));
 
     Crypto::AesCcm::GenerateNonce(aExtAddress, frameCounter, securityLevel, nonce);
 
-    aesCcm.SetKey(GetAesKey());
     tagLength = GetFooterLength() - GetFcsSize();
 
-    aesCcm.Init(GetHeaderLength(), GetPayloadLength(), tagLength, nonce, sizeof(nonce));
-    aesCcm.Header(GetHeader(), GetHeaderLength());
-    aesCcm.Payload(GetPayload(), GetPayload(), GetPayloadLength(), Crypto::AesCcm::kEncrypt);
-    aesCcm.Finalize(GetFooter());
+    aAesCcm.Init(GetHeaderLength(), GetPayloadLength(), tagLength, nonce, sizeof(nonce));
+    aAesCcm.Header(GetHeader(), GetHeaderLength());
+    aAesCcm.Payload(GetPayload(), GetPayload(), GetPayloadLength(), Crypto::AesCcm::kEncrypt);
+    aAesCcm.Finalize(GetFooter());
 
     SetIsSecurityProcessed(true);
 
@@ -1491,14 +1507,34 @@ Error RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const KeyMate
 
     return kErrorNone;
 #else
-    Error          error        = kErrorSecurity;
-    uint32_t       frameCounter = 0;
-    uint8_t        securityLevel;
-    uint8_t        nonce[Crypto::AesCcm::kNonceSize];
-    uint8_t        tag[kMaxMicSize];
-    uint8_t        tagLength;
+    Error          error = kErrorNone;
     Crypto::AesCcm aesCcm;
 
+    VerifyOrExit(GetSecurityEnabled());
+
+    aesCcm.SetKey(aMacKey);
+    error = ProcessReceiveAesCcm(aExtAddress, aesCcm);
+
+exit:
+    return error;
+#endif // OPENTHREAD_RADIO
+}
+
+Error RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, Crypto::AesCcm &aAesCcm)
+{
+#if OPENTHREAD_RADIO
+    OT_UNUSED_VARIABLE(aExtAddress);
+    OT_UNUSED_VARIABLE(aAesCcm);
+
+    return kErrorNone;
+#else
+    Error    error        = kErrorSecurity;
+    uint32_t frameCounter = 0;
+    uint8_t  securityLevel;
+    uint8_t  nonce[Crypto::AesCcm::kNonceSize];
+    uint8_t  tag[kMaxMicSize];
+    uint8_t  tagLength;
+
     VerifyOrExit(GetSecurityEnabled(), error = kErrorNone);
 
     SuccessOrExit(GetSecurityLevel(securityLevel));
@@ -1506,19 +1542,18 @@ Error RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const KeyMate
 
     Crypto::AesCcm::GenerateNonce(aExtAddress, frameCounter, securityLevel, nonce);
 
-    aesCcm.SetKey(aMacKey);
     tagLength = GetFooterLength() - GetFcsSize();
 
-    aesCcm.Init(GetHeaderLength(), GetPayloadLength(), tagLength, nonce, sizeof(nonce));
-    aesCcm.Header(GetHeader(), GetHeaderLength());
+    aAesCcm.Init(GetHeaderLength(), GetPayloadLength(), tagLength, nonce, sizeof(nonce));
+    aAesCcm.Header(GetHeader(), GetHeaderLength());
 #ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
-    aesCcm.Payload(GetPayload(), GetPayload(), GetPayloadLength(), Crypto::AesCcm::kDecrypt);
+    aAesCcm.Payload(GetPayload(), GetPayload(), GetPayloadLength(), Crypto::AesCcm::kDecrypt);
 #else
     // For fuzz tests, execute AES but do not alter the payload
     uint8_t fuzz[OT_RADIO_FRAME_MAX_SIZE];
-    aesCcm.Payload(fuzz, GetPayload(), GetPayloadLength(), Crypto::AesCcm::kDecrypt);
+    aAesCcm.Payload(fuzz, GetPayload(), GetPayloadLength(), Crypto::AesCcm::kDecrypt);
 #endif
-    aesCcm.Finalize(tag);
+    aAesCcm.Finalize(tag);
 
 #ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
     VerifyOrExit(memcmp(tag, GetFooter(), tagLength) == 0);
@@ -42,6 +42,7 @@
 #include "common/as_core_type.hpp"
 #include "common/const_cast.hpp"
 #include "common/encoding.hpp"
+#include "crypto/aes_ccm.hpp"
 #include "mac/mac_types.hpp"
 #include "meshcop/network_name.hpp"
 
@@ -1239,6 +1240,19 @@ public:
      */
     Error ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const KeyMaterial &aMacKey);
 
+    /**
+     * Performs AES CCM on the frame which is received, using an `AesCcm` already keyed with the MAC key.
+     *
+     * @param[in]  aExtAddress  A reference to the extended address, which will be used to generate nonce
+     *                          for AES CCM computation.
+     * @param[in]  aAesCcm      A reference to the `AesCcm` keyed with the MAC key to decrypt the received frame.
+     *
+     * @retval kErrorNone      Process of received frame AES CCM succeeded.
+     * @retval kErrorSecurity  Received frame MIC check failed.
+     *
+     */
+    Error ProcessReceiveAesCcm(const ExtAddress &aExtAddress, Crypto::AesCcm &aAesCcm);
+
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
     /**
      * Gets the offset to network time.
@@ -1415,6 +1429,16 @@ public:
      */
     void ProcessTransmitAesCcm(const ExtAddress &aExtAddress);
 
+    /**
+     * Performs AES CCM on the frame which is going to be sent, using an `AesCcm` already keyed with the MAC key.
+     *
+     * @param[in]  aExtAddress  A reference to the extended address, which will be used to generate nonce
+     *                          for AES CCM computation.
+     * @param[in]  aAesCcm      A reference to the `AesCcm` keyed with the MAC key to encrypt the frame.
+     *
+     */
+    void ProcessTransmitAesCcm(const ExtAddress &aExtAddress, Crypto::AesCcm &aAesCcm);
+
     /**
      * Indicates whether or not the frame has security processed.
      *
@@ -90,6 +90,28 @@ void ExtAddress::CopyAddress(uint8_t *aDst, const uint8_t *aSrc, CopyByteOrder a
     }
 }
 
+bool Address::operator==(const Address &aOther) const
+{
+    bool isEqual = (mType == aOther.mType);
+
+    VerifyOrExit(isEqual);
+
+    switch (mType)
+    {
+    case kTypeShort:
+        isEqual = (GetShort() == aOther.GetShort());
+        break;
+    case kTypeExtended:
+        isEqual = (GetExtended() == aOther.GetExtended());
+        break;
+    case kTypeNone:
+        break;
+    }
+
+exit:
+    return isEqual;
+}
+
 Address::InfoString Address::ToString(void) const
 {
     InfoString string;
@@ -87,9 +87,7 @@ void SubMac::Init(void)
     mRadioFilterEnabled = false;
 #endif
 
-    mPrevKey.Clear();
-    mCurrKey.Clear();
-    mNextKey.Clear();
+    ClearMacKeys();
 
     mFrameCounter = 0;
     mKeyId        = 0;
@@ -449,7 +447,11 @@ void SubMac::ProcessTransmitSecurity(void)
     VerifyOrExit(mTransmitFrame.GetTimeIeOffset() == 0);
 #endif
 
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    mTransmitFrame.ProcessTransmitAesCcm(*extAddress, mCurrKeyAesCcm);
+#else
     mTransmitFrame.ProcessTransmitAesCcm(*extAddress);
+#endif
 
 exit:
     return;
@@ -995,6 +997,11 @@ void SubMac::SetMacKey(uint8_t            aKeyIdMode,
         mPrevKey = aPrevKey;
         mCurrKey = aCurrKey;
         mNextKey = aNextKey;
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+        mPrevKeyAesCcm.SetKey(mPrevKey);
+        mCurrKeyAesCcm.SetKey(mCurrKey);
+        mNextKeyAesCcm.SetKey(mNextKey);
+#endif
         break;
 
     default:
@@ -1010,6 +1017,41 @@ exit:
     return;
 }
 
+void SubMac::ClearMacKeys(void)
+{
+    mPrevKey.Clear();
+    mCurrKey.Clear();
+    mNextKey.Clear();
+
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    mPrevKeyAesCcm.SetKey(mPrevKey);
+    mCurrKeyAesCcm.SetKey(mCurrKey);
+    mNextKeyAesCcm.SetKey(mNextKey);
+#endif
+}
+
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+Crypto::AesCcm *SubMac::GetKeyedAesCcm(const KeyMaterial &aMacKey)
+{
+    Crypto::AesCcm *aesCcm = nullptr;
+
+    if (&aMacKey == &mCurrKey)
+    {
+        aesCcm = &mCurrKeyAesCcm;
+    }
+    else if (&aMacKey == &mPrevKey)
+    {
+        aesCcm = &mPrevKeyAesCcm;
+    }
+    else if (&aMacKey == &mNextKey)
+    {
+        aesCcm = &mNextKeyAesCcm;
+    }
+
+    return aesCcm;
+}
+#endif
+
 void SubMac::SignalFrameCounterUsed(uint32_t aFrameCounter, uint8_t aKeyId)
 {
     VerifyOrExit(aKeyId == mKeyId);
@@ -82,6 +82,10 @@ namespace Mac {
 #error "OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE is required for OPENTHREAD_CONFIG_MAC_CSL_DEBUG_ENABLE."
 #endif
 
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE && OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+#error "OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE is not supported with key references."
+#endif
+
 #if OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
 class LinkRaw;
 #endif
@@ -472,16 +476,25 @@ public:
      */
     const KeyMaterial &GetNextMacKey(void) const { return mNextKey; }
 
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    /**
+     * Returns the `AesCcm` already keyed with a given MAC key.
+     *
+     * Only the previous, current and next MAC keys stored in `SubMac` have a keyed `AesCcm`.
+     *
+     * @param[in] aMacKey  A reference to the MAC key.
+     *
+     * @returns A pointer to the keyed `AesCcm`, or `nullptr` if @p aMacKey is not one of the stored MAC keys.
+     *
+     */
+    Crypto::AesCcm *GetKeyedAesCcm(const KeyMaterial &aMacKey);
+#endif
+
     /**
      * Clears the stored MAC keys.
      *
      */
-    void ClearMacKeys(void)
-    {
-        mPrevKey.Clear();
-        mCurrKey.Clear();
-        mNextKey.Clear();
-    }
+    void ClearMacKeys(void);
 
     /**
      * Returns the current MAC frame counter value.
@@ -654,6 +667,11 @@ private:
     KeyMaterial                  mPrevKey;
     KeyMaterial                  mCurrKey;
     KeyMaterial                  mNextKey;
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    Crypto::AesCcm mPrevKeyAesCcm;
+    Crypto::AesCcm mCurrKeyAesCcm;
+    Crypto::AesCcm mNextKeyAesCcm;
+#endif
     uint32_t                     mFrameCounter;
     uint8_t                      mKeyId;
 #if OPENTHREAD_CONFIG_MAC_ADD_DELAY_ON_NO_ACK_ERROR_BEFORE_RETRY
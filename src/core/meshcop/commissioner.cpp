@@ -114,7 +114,7 @@ void Commissioner::SignalJoinerEvent(JoinerEvent aEvent, const Joiner *aJoiner)
 
     if (aJoiner->mType == Joiner::kTypeEui64)
     {
-        ComputeJoinerId(aJoiner->mSharedId.mEui64, joinerId);
+        joinerId = aJoiner->mJoinerId;
     }
     else if (aJoiner == mActiveJoiner)
     {
@@ -212,8 +212,7 @@ Commissioner::Joiner *Commissioner::FindJoinerEntry(const JoinerDiscerner &aDisc
 
 Commissioner::Joiner *Commissioner::FindBestMatchingJoinerEntry(const Mac::ExtAddress &aReceivedJoinerId)
 {
-    Joiner         *best = nullptr;
-    Mac::ExtAddress joinerId;
+    Joiner *best = nullptr;
 
     // Prefer a full Joiner ID match, if not found use the entry
     // accepting any joiner.
@@ -233,8 +232,7 @@ Commissioner::Joiner *Commissioner::FindBestMatchingJoinerEntry(const Mac::ExtAd
             break;
 
         case Joiner::kTypeEui64:
-            ComputeJoinerId(joiner.mSharedId.mEui64, joinerId);
-            if (joinerId == aReceivedJoinerId)
+            if (joiner.mJoinerId == aReceivedJoinerId)
             {
                 ExitNow(best = &joiner);
             }
@@ -375,8 +373,6 @@ exit:
 
 void Commissioner::ComputeBloomFilter(SteeringData &aSteeringData) const
 {
-    Mac::ExtAddress joinerId;
-
     aSteeringData.Init();
 
     for (const Joiner &joiner : mJoiners)
@@ -387,8 +383,7 @@ void Commissioner::ComputeBloomFilter(SteeringData &aSteeringData) const
             break;
 
         case Joiner::kTypeEui64:
-            ComputeJoinerId(joiner.mSharedId.mEui64, joinerId);
-            aSteeringData.UpdateBloomFilter(joinerId);
+            aSteeringData.UpdateBloomFilter(joiner.mJoinerId);
             break;
 
         case Joiner::kTypeDiscerner:
@@ -471,6 +466,7 @@ Error Commissioner::AddJoiner(const Mac::ExtAddress *aEui64,
     {
         joiner->mType            = Joiner::kTypeEui64;
         joiner->mSharedId.mEui64 = *aEui64;
+        ComputeJoinerId(*aEui64, joiner->mJoinerId);
     }
     else
     {
@@ -526,8 +526,9 @@ private:
             JoinerDiscerner mDiscerner;
         } mSharedId;
 
-        JoinerPskd mPskd;
-        Type       mType;
+        Mac::ExtAddress mJoinerId; // Joiner ID computed from `mEui64` (for `kTypeEui64`).
+        JoinerPskd      mPskd;
+        Type            mType;
 
         void CopyToJoinerInfo(otJoinerInfo &aJoiner) const;
     };
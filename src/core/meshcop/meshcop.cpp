@@ -251,11 +251,8 @@ void SteeringData::CalculateHashBitIndexes(const Mac::ExtAddress &aJoinerId, Has
     Crc16 ccitt(Crc16::kCcitt);
     Crc16 ansi(Crc16::kAnsi);
 
-    for (uint8_t b : aJoinerId.m8)
-    {
-        ccitt.Update(b);
-        ansi.Update(b);
-    }
+    ccitt.Update(aJoinerId.m8, sizeof(aJoinerId.m8));
+    ansi.Update(aJoinerId.m8, sizeof(aJoinerId.m8));
 
     aIndexes.mIndex[0] = ccitt.Get();
     aIndexes.mIndex[1] = ansi.Get();
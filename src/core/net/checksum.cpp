@@ -33,6 +33,8 @@
 
 #include "checksum.hpp"
 
+#include <string.h>
+
 #include "common/code_utils.hpp"
 #include "common/message.hpp"
 #include "net/icmp6.hpp"
@@ -70,10 +72,62 @@ void Checksum::AddUint16(uint16_t aUint16)
 
 void Checksum::AddData(const uint8_t *aBuffer, uint16_t aLength)
 {
-    for (uint16_t i = 0; i < aLength; i++)
+    // The data is summed a 32-bit word at a time (in host byte order)
+    // into a wide accumulator which is then folded to 16 bits. Since
+    // one's complement addition is byte-order independent (RFC-1071)
+    // swapping the folded sum yields the big-endian 16-bit sum.
+
+    uint64_t sum = 0;
+    uint16_t newValue;
+
+    VerifyOrExit(aLength > 0);
+
+    if (mAtOddIndex)
     {
-        AddUint8(aBuffer[i]);
+        AddUint8(*aBuffer++);
+        aLength--;
+    }
+
+    for (; aLength >= sizeof(uint32_t); aBuffer += sizeof(uint32_t), aLength -= sizeof(uint32_t))
+    {
+        uint32_t word;
+
+        memcpy(&word, aBuffer, sizeof(word));
+        sum += word;
     }
+
+    if (aLength >= sizeof(uint16_t))
+    {
+        uint16_t halfWord;
+
+        memcpy(&halfWord, aBuffer, sizeof(halfWord));
+        sum += halfWord;
+
+        aBuffer += sizeof(uint16_t);
+        aLength -= sizeof(uint16_t);
+    }
+
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    newValue = mValue + Encoding::BigEndian::HostSwap16(static_cast<uint16_t>(sum));
+
+    if (newValue < mValue)
+    {
+        newValue++;
+    }
+
+    mValue = newValue;
+
+    if (aLength > 0)
+    {
+        AddUint8(*aBuffer);
+    }
+
+exit:
+    return;
 }
 
 void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
@@ -656,10 +656,17 @@ Error Ip6::HandleFragment(Message &aMessage, MessageOrigin aOrigin, MessageInfo
 
     for (Message &msg : mReassemblyList)
     {
+        // Check the identification (kept in message metadata) first
+        // so the IPv6 header is only read for a likely match.
+
+        if (msg.GetDatagramTag() != fragmentHeader.GetIdentification())
+        {
+            continue;
+        }
+
         SuccessOrExit(error = msg.Read(0, headerBuffer));
 
-        if (msg.GetDatagramTag() == fragmentHeader.GetIdentification() &&
-            headerBuffer.GetSource() == header.GetSource() && headerBuffer.GetDestination() == header.GetDestination())
+        if (headerBuffer.GetSource() == header.GetSource() && headerBuffer.GetDestination() == header.GetDestination())
         {
             message = &msg;
             break;
@@ -639,6 +639,39 @@ public:
      */
     Error AddSrcMatchExtEntry(const Mac::ExtAddress &aExtAddress);
 
+    /**
+     * Adds a number of short addresses to the source address match table.
+     *
+     * The entries are added in order. On failure, the first @p aNumAdded entries were added and the remaining ones
+     * were not.
+     *
+     * @param[in]  aShortAddresses  A pointer to an array of short addresses to be added.
+     * @param[in]  aNumEntries      The number of entries in @p aShortAddresses.
+     * @param[out] aNumAdded        A reference to output the number of entries that were added.
+     *
+     * @retval kErrorNone     Successfully added all short addresses to the source match table.
+     * @retval kErrorNoBufs   No available entry in the source match table.
+     *
+     */
+    Error AddSrcMatchShortEntries(const Mac::ShortAddress *aShortAddresses, uint16_t aNumEntries, uint16_t &aNumAdded);
+
+    /**
+     * Adds a number of extended addresses to the source address match table.
+     *
+     * The entries are added in order. On failure, the first @p aNumAdded entries were added and the remaining ones
+     * were not.
+     *
+     * @param[in]  aExtAddresses  A pointer to an array of extended addresses to be added stored in little-endian byte
+     *                            order.
+     * @param[in]  aNumEntries    The number of entries in @p aExtAddresses.
+     * @param[out] aNumAdded      A reference to output the number of entries that were added.
+     *
+     * @retval kErrorNone     Successfully added all extended addresses to the source match table.
+     * @retval kErrorNoBufs   No available entry in the source match table.
+     *
+     */
+    Error AddSrcMatchExtEntries(const Mac::ExtAddress *aExtAddresses, uint16_t aNumEntries, uint16_t &aNumAdded);
+
     /**
      * Removes a short address from the source address match table.
      *
@@ -895,6 +928,20 @@ inline Error Radio::AddSrcMatchExtEntry(const Mac::ExtAddress &aExtAddress)
     return otPlatRadioAddSrcMatchExtEntry(GetInstancePtr(), &aExtAddress);
 }
 
+inline Error Radio::AddSrcMatchShortEntries(const Mac::ShortAddress *aShortAddresses,
+                                            uint16_t                 aNumEntries,
+                                            uint16_t                &aNumAdded)
+{
+    return otPlatRadioAddSrcMatchShortEntries(GetInstancePtr(), aShortAddresses, aNumEntries, &aNumAdded);
+}
+
+inline Error Radio::AddSrcMatchExtEntries(const Mac::ExtAddress *aExtAddresses,
+                                          uint16_t               aNumEntries,
+                                          uint16_t              &aNumAdded)
+{
+    return otPlatRadioAddSrcMatchExtEntries(GetInstancePtr(), aExtAddresses, aNumEntries, &aNumAdded);
+}
+
 inline Error Radio::ClearSrcMatchShortEntry(Mac::ShortAddress aShortAddress)
 {
     return otPlatRadioClearSrcMatchShortEntry(GetInstancePtr(), aShortAddress);
@@ -990,6 +1037,20 @@ inline Error Radio::AddSrcMatchShortEntry(Mac::ShortAddress) { return kErrorNone
 
 inline Error Radio::AddSrcMatchExtEntry(const Mac::ExtAddress &) { return kErrorNone; }
 
+inline Error Radio::AddSrcMatchShortEntries(const Mac::ShortAddress *, uint16_t aNumEntries, uint16_t &aNumAdded)
+{
+    aNumAdded = aNumEntries;
+
+    return kErrorNone;
+}
+
+inline Error Radio::AddSrcMatchExtEntries(const Mac::ExtAddress *, uint16_t aNumEntries, uint16_t &aNumAdded)
+{
+    aNumAdded = aNumEntries;
+
+    return kErrorNone;
+}
+
 inline Error Radio::ClearSrcMatchShortEntry(Mac::ShortAddress) { return kErrorNone; }
 
 inline Error Radio::ClearSrcMatchExtEntry(const Mac::ExtAddress &) { return kErrorNone; }
@@ -314,3 +314,35 @@ OT_TOOL_WEAK otError otPlatRadioReceiveAt(otInstance *aInstance, uint8_t aChanne
 
     return kErrorNotImplemented;
 }
+
+OT_TOOL_WEAK otError otPlatRadioAddSrcMatchShortEntries(otInstance           *aInstance,
+                                                        const otShortAddress *aShortAddresses,
+                                                        uint16_t              aNumEntries,
+                                                        uint16_t             *aNumAdded)
+{
+    Error error = kErrorNone;
+
+    for (*aNumAdded = 0; *aNumAdded < aNumEntries; (*aNumAdded)++)
+    {
+        SuccessOrExit(error = otPlatRadioAddSrcMatchShortEntry(aInstance, aShortAddresses[*aNumAdded]));
+    }
+
+exit:
+    return error;
+}
+
+OT_TOOL_WEAK otError otPlatRadioAddSrcMatchExtEntries(otInstance         *aInstance,
+                                                      const otExtAddress *aExtAddresses,
+                                                      uint16_t            aNumEntries,
+                                                      uint16_t           *aNumAdded)
+{
+    Error error = kErrorNone;
+
+    for (*aNumAdded = 0; *aNumAdded < aNumEntries; (*aNumAdded)++)
+    {
+        SuccessOrExit(error = otPlatRadioAddSrcMatchExtEntry(aInstance, &aExtAddresses[*aNumAdded]));
+    }
+
+exit:
+    return error;
+}
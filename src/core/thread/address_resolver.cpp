@@ -60,6 +60,7 @@ AddressResolver::AddressResolver(Instance &aInstance)
 #endif
 {
 #if OPENTHREAD_FTD
+    ClearCacheIndex();
     IgnoreError(Get<Ip6::Icmp>().RegisterHandler(mIcmpHandler));
 #endif
 }
@@ -84,6 +85,8 @@ void AddressResolver::Clear(void)
             mCacheEntryPool.Free(*entry);
         }
     }
+
+    ClearCacheIndex();
 }
 
 Error AddressResolver::GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const
@@ -208,20 +211,130 @@ AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address
                                                              CacheEntryList    *&aList,
                                                              CacheEntry        *&aPrevEntry)
 {
-    CacheEntry     *entry   = nullptr;
+    CacheEntry     *entry   = FindInCacheIndex(aEid);
     CacheEntryList *lists[] = {&mCachedList, &mSnoopedList, &mQueryList, &mQueryRetryList};
 
+    // The cache index gives the matching entry directly. We then
+    // determine the list containing it along with its previous entry
+    // in the list (needed to remove it from the list), which only
+    // requires comparing entry pointers.
+
+    VerifyOrExit(entry != nullptr);
+
     for (CacheEntryList *list : lists)
     {
         aList = list;
-        entry = aList->FindMatching(aEid, aPrevEntry);
-        VerifyOrExit(entry == nullptr);
+        VerifyOrExit(aList->Find(*entry, aPrevEntry) != kErrorNone);
     }
 
+    OT_ASSERT(false);
+
 exit:
     return entry;
 }
 
+void AddressResolver::ClearCacheIndex(void)
+{
+    for (uint16_t &slot : mCacheIndex)
+    {
+        slot = kEmptyIndexSlot;
+    }
+}
+
+uint16_t AddressResolver::GetCacheIndexSlot(const Ip6::Address &aEid)
+{
+    // Returns the home slot in the cache index for a given EID,
+    // hashing the two 32-bit words of its IID.
+
+    uint32_t hash = aEid.GetIid().mFields.m32[0] ^ (aEid.GetIid().mFields.m32[1] * 0x9e3779b1U);
+
+    hash ^= (hash >> 16);
+    hash *= 0x85ebca6bU;
+    hash ^= (hash >> 13);
+
+    return static_cast<uint16_t>(hash % kCacheIndexSize);
+}
+
+void AddressResolver::AddToCacheIndex(const CacheEntry &aEntry)
+{
+    uint16_t slot = GetCacheIndexSlot(aEntry.GetTarget());
+
+    while (mCacheIndex[slot] != kEmptyIndexSlot)
+    {
+        slot = NextCacheIndexSlot(slot);
+    }
+
+    mCacheIndex[slot] = mCacheEntryPool.GetIndexOf(aEntry);
+}
+
+void AddressResolver::RemoveFromCacheIndex(const CacheEntry &aEntry)
+{
+    uint16_t entryIndex = mCacheEntryPool.GetIndexOf(aEntry);
+    uint16_t slot       = GetCacheIndexSlot(aEntry.GetTarget());
+    uint16_t next;
+
+    while (mCacheIndex[slot] != entryIndex)
+    {
+        VerifyOrExit(mCacheIndex[slot] != kEmptyIndexSlot);
+        slot = NextCacheIndexSlot(slot);
+    }
+
+    // Remove the entry using backward shift deletion: Any following
+    // entry in the same probe sequence that would no longer be
+    // reachable from its home slot is moved into the vacated slot.
+
+    next = slot;
+
+    while (true)
+    {
+        uint16_t home;
+
+        next = NextCacheIndexSlot(next);
+
+        if (mCacheIndex[next] == kEmptyIndexSlot)
+        {
+            break;
+        }
+
+        home = GetCacheIndexSlot(mCacheEntryPool.GetEntryAt(mCacheIndex[next]).GetTarget());
+
+        // Check whether `home` lies cyclically outside of the range
+        // `(slot, next]`, i.e., the entry at `next` can be moved.
+
+        if (CacheIndexDistance(home, next) >= CacheIndexDistance(slot, next))
+        {
+            mCacheIndex[slot] = mCacheIndex[next];
+            slot              = next;
+        }
+    }
+
+    mCacheIndex[slot] = kEmptyIndexSlot;
+
+exit:
+    return;
+}
+
+AddressResolver::CacheEntry *AddressResolver::FindInCacheIndex(const Ip6::Address &aEid)
+{
+    CacheEntry *entry = nullptr;
+    uint16_t    slot  = GetCacheIndexSlot(aEid);
+
+    while (mCacheIndex[slot] != kEmptyIndexSlot)
+    {
+        CacheEntry &cur = mCacheEntryPool.GetEntryAt(mCacheIndex[slot]);
+
+        if (cur.Matches(aEid))
+        {
+            entry = &cur;
+            break;
+        }
+
+        slot = NextCacheIndexSlot(slot);
+    }
+
+    return entry;
+}
+
 void AddressResolver::RemoveEntryForAddress(const Ip6::Address &aEid) { Remove(aEid, kReasonRemovingEid); }
 
 void AddressResolver::Remove(const Ip6::Address &aEid, Reason aReason)
@@ -328,6 +441,7 @@ void AddressResolver::RemoveCacheEntry(CacheEntry     &aEntry,
                                        Reason          aReason)
 {
     aList.PopAfter(aPrevEntry);
+    RemoveFromCacheIndex(aEntry);
 
     if (&aList == &mQueryList)
     {
@@ -432,6 +546,7 @@ void AddressResolver::UpdateSnoopedCacheEntry(const Ip6::Address &aEid,
     }
 
     mSnoopedList.Push(*entry);
+    AddToCacheIndex(*entry);
 
     LogCacheEntryChange(kEntryAdded, kReasonSnoop, *entry);
 
@@ -553,10 +668,21 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
     entry->SetTimeout(kAddressQueryTimeout);
 
     error = SendAddressQuery(aEid);
-    VerifyOrExit(error == kErrorNone, mCacheEntryPool.Free(*entry));
+
+    if (error != kErrorNone)
+    {
+        if (list != nullptr)
+        {
+            RemoveFromCacheIndex(*entry);
+        }
+
+        mCacheEntryPool.Free(*entry);
+        ExitNow();
+    }
 
     if (list == nullptr)
     {
+        AddToCacheIndex(*entry);
         LogCacheEntryChange(kEntryAdded, kReasonQueryRequest, *entry);
     }
 
@@ -319,6 +319,13 @@ private:
 
     typedef Pool<CacheEntry, kCacheEntries> CacheEntryPool;
 
+    // The cache index is an open-addressing (linear probing) hash
+    // table over `mCacheEntryPool` keyed on the IID of the entry's
+    // target. It is sized to keep the load factor at most 0.5.
+
+    static constexpr uint16_t kCacheIndexSize = 2 * kCacheEntries;
+    static constexpr uint16_t kEmptyIndexSlot = 0xffff;
+
     class CacheEntryList : public LinkedList<CacheEntry>
     {
     };
@@ -352,6 +359,20 @@ private:
     void        RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, CacheEntry *aPrevEntry, Reason aReason);
     Error       UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16);
     Error       SendAddressQuery(const Ip6::Address &aEid);
+    void        ClearCacheIndex(void);
+    void        AddToCacheIndex(const CacheEntry &aEntry);
+    void        RemoveFromCacheIndex(const CacheEntry &aEntry);
+    CacheEntry *FindInCacheIndex(const Ip6::Address &aEid);
+
+    static uint16_t GetCacheIndexSlot(const Ip6::Address &aEid);
+    static uint16_t NextCacheIndexSlot(uint16_t aSlot)
+    {
+        return (aSlot + 1 < kCacheIndexSize) ? static_cast<uint16_t>(aSlot + 1) : 0;
+    }
+    static uint16_t CacheIndexDistance(uint16_t aFrom, uint16_t aTo)
+    {
+        return static_cast<uint16_t>((aTo >= aFrom) ? (aTo - aFrom) : (aTo + kCacheIndexSize - aFrom));
+    }
 #if OPENTHREAD_CONFIG_TMF_ALLOW_ADDRESS_RESOLUTION_USING_NET_DATA_SERVICES
     Error ResolveUsingNetDataServices(const Ip6::Address &aEid, Mac::ShortAddress &aRloc16);
 #endif
@@ -386,6 +407,7 @@ private:
     CacheEntryList     mSnoopedList;
     CacheEntryList     mQueryList;
     CacheEntryList     mQueryRetryList;
+    uint16_t           mCacheIndex[kCacheIndexSize];
     Ip6::Icmp::Handler mIcmpHandler;
 
 #endif // OPENTHREAD_FTD
@@ -112,6 +112,7 @@ void Child::Clear(void)
 {
     Instance &instance = GetInstance();
 
+    Get<ChildTable>().RemoveFromIndex(*this);
     memset(reinterpret_cast<void *>(this), 0, sizeof(Child));
     Init(instance);
 }
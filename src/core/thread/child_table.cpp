@@ -36,6 +36,7 @@
 #if OPENTHREAD_FTD
 
 #include "common/code_utils.hpp"
+#include "common/encoding.hpp"
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
 
@@ -77,6 +78,8 @@ ChildTable::ChildTable(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mMaxChildrenAllowed(kMaxChildren)
 {
+    ClearIndex();
+
     for (Child &child : mChildren)
     {
         child.Init(aInstance);
@@ -90,6 +93,8 @@ void ChildTable::Clear(void)
     {
         child.Clear();
     }
+
+    ClearIndex();
 }
 
 Child *ChildTable::GetChildAtIndex(uint16_t aChildIndex)
@@ -134,17 +139,164 @@ exit:
 
 Child *ChildTable::FindChild(uint16_t aRloc16, Child::StateFilter aFilter)
 {
-    return FindChild(Child::AddressMatcher(aRloc16, aFilter));
+    Child::AddressMatcher matcher(aRloc16, aFilter);
+    Child                *child = nullptr;
+
+    // An invalid short address is treated by `AddressMatcher` as
+    // matching any address, so it cannot be looked up in the index.
+
+    if (!CanUseIndex(aFilter) || (aRloc16 == Mac::kShortAddrInvalid))
+    {
+        ExitNow(child = FindChild(matcher));
+    }
+
+    for (uint16_t index = mRloc16Buckets[GetRloc16Bucket(aRloc16)]; index != kInvalidIndex; index = mRloc16Next[index])
+    {
+        if (mChildren[index].Matches(matcher))
+        {
+            child = &mChildren[index];
+            break;
+        }
+    }
+
+exit:
+    return child;
 }
 
 Child *ChildTable::FindChild(const Mac::ExtAddress &aExtAddress, Child::StateFilter aFilter)
 {
-    return FindChild(Child::AddressMatcher(aExtAddress, aFilter));
+    Child::AddressMatcher matcher(aExtAddress, aFilter);
+    Child                *child = nullptr;
+
+    VerifyOrExit(CanUseIndex(aFilter), child = FindChild(matcher));
+
+    for (uint16_t index = mExtAddressBuckets[GetExtAddressBucket(aExtAddress)]; index != kInvalidIndex;
+         index          = mExtAddressNext[index])
+    {
+        if (mChildren[index].Matches(matcher))
+        {
+            child = &mChildren[index];
+            break;
+        }
+    }
+
+exit:
+    return child;
 }
 
 Child *ChildTable::FindChild(const Mac::Address &aMacAddress, Child::StateFilter aFilter)
 {
-    return FindChild(Child::AddressMatcher(aMacAddress, aFilter));
+    Child *child;
+
+    switch (aMacAddress.GetType())
+    {
+    case Mac::Address::kTypeShort:
+        child = FindChild(aMacAddress.GetShort(), aFilter);
+        break;
+    case Mac::Address::kTypeExtended:
+        child = FindChild(aMacAddress.GetExtended(), aFilter);
+        break;
+    default:
+        child = FindChild(Child::AddressMatcher(aMacAddress, aFilter));
+        break;
+    }
+
+    return child;
+}
+
+bool ChildTable::CanUseIndex(Child::StateFilter aFilter)
+{
+    // The index only contains children in a state other than
+    // `kStateInvalid`, so it can be used for any filter which
+    // never accepts an invalid child.
+
+    bool canUse = false;
+
+    switch (aFilter)
+    {
+    case Child::kInStateValid:
+    case Child::kInStateValidOrRestoring:
+    case Child::kInStateChildIdRequest:
+    case Child::kInStateValidOrAttaching:
+    case Child::kInStateAnyExceptInvalid:
+        canUse = true;
+        break;
+    case Child::kInStateInvalid:
+    case Child::kInStateAnyExceptValidOrRestoring:
+    case Child::kInStateAny:
+        break;
+    }
+
+    return canUse;
+}
+
+uint16_t ChildTable::GetRloc16Bucket(uint16_t aRloc16) { return Mle::ChildIdFromRloc16(aRloc16) % kNumIndexBuckets; }
+
+uint16_t ChildTable::GetExtAddressBucket(const Mac::ExtAddress &aExtAddress)
+{
+    uint32_t hash = Encoding::BigEndian::ReadUint32(&aExtAddress.m8[0]) ^
+                    Encoding::BigEndian::ReadUint32(&aExtAddress.m8[4]);
+
+    return static_cast<uint16_t>(((hash >> 16) ^ hash) % kNumIndexBuckets);
+}
+
+void ChildTable::ClearIndex(void)
+{
+    for (uint16_t index = 0; index < kNumIndexBuckets; index++)
+    {
+        mRloc16Buckets[index]     = kInvalidIndex;
+        mExtAddressBuckets[index] = kInvalidIndex;
+    }
+}
+
+void ChildTable::AddToIndex(const Neighbor &aNeighbor)
+{
+    const Child *child = static_cast<const Child *>(&aNeighbor);
+    uint16_t     childIndex;
+    uint16_t     bucket;
+
+    VerifyOrExit(Contains(aNeighbor) && !child->IsStateInvalid());
+
+    childIndex = GetChildIndex(*child);
+
+    bucket                  = GetRloc16Bucket(child->GetRloc16());
+    mRloc16Next[childIndex] = mRloc16Buckets[bucket];
+    mRloc16Buckets[bucket]  = childIndex;
+
+    bucket                      = GetExtAddressBucket(child->GetExtAddress());
+    mExtAddressNext[childIndex] = mExtAddressBuckets[bucket];
+    mExtAddressBuckets[bucket]  = childIndex;
+
+exit:
+    return;
+}
+
+void ChildTable::RemoveFromIndex(const Neighbor &aNeighbor)
+{
+    const Child *child = static_cast<const Child *>(&aNeighbor);
+    uint16_t     childIndex;
+
+    VerifyOrExit(Contains(aNeighbor) && !child->IsStateInvalid());
+
+    childIndex = GetChildIndex(*child);
+
+    RemoveFromChain(mRloc16Buckets[GetRloc16Bucket(child->GetRloc16())], mRloc16Next, childIndex);
+    RemoveFromChain(mExtAddressBuckets[GetExtAddressBucket(child->GetExtAddress())], mExtAddressNext, childIndex);
+
+exit:
+    return;
+}
+
+void ChildTable::RemoveFromChain(uint16_t &aHead, uint16_t *aNextArray, uint16_t aChildIndex)
+{
+    for (uint16_t *index = &aHead; *index != kInvalidIndex; index = &aNextArray[*index])
+    {
+        if (*index == aChildIndex)
+        {
+            *index = aNextArray[aChildIndex];
+            break;
+        }
+    }
 }
 
 bool ChildTable::HasChildren(Child::StateFilter aFilter) const
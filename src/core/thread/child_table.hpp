@@ -53,6 +53,8 @@ namespace ot {
 class ChildTable : public InstanceLocator, private NonCopyable
 {
     friend class NeighborTable;
+    friend class Neighbor;
+    friend class Child;
     class IteratorBuilder;
 
 public:
@@ -323,6 +325,19 @@ public:
 private:
     static constexpr uint16_t kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN;
 
+    // All children in a state other than `kStateInvalid` are kept in
+    // two lookup indexes: one keyed by the child ID from RLOC16 and
+    // one keyed by a hash of the Extended Address. Each index is an
+    // array of buckets holding the child array index of the first
+    // entry of a singly linked chain; `mRloc16Next` and
+    // `mExtAddressNext` (indexed by child array index) link the
+    // entries within a chain. The indexes are updated by `Neighbor`
+    // whenever the state, RLOC16 or Extended Address of a child entry
+    // changes, and by `Child::Clear()`.
+
+    static constexpr uint16_t kNumIndexBuckets = kMaxChildren;
+    static constexpr uint16_t kInvalidIndex    = 0xffff;
+
     class IteratorBuilder : public InstanceLocator
     {
     public:
@@ -343,9 +358,21 @@ private:
 
     const Child *FindChild(const Child::AddressMatcher &aMatcher) const;
     void         RefreshStoredChildren(void);
+    void         ClearIndex(void);
+    void         AddToIndex(const Neighbor &aNeighbor);
+    void         RemoveFromIndex(const Neighbor &aNeighbor);
+    void         RemoveFromChain(uint16_t &aHead, uint16_t *aNextArray, uint16_t aChildIndex);
+
+    static bool     CanUseIndex(Child::StateFilter aFilter);
+    static uint16_t GetRloc16Bucket(uint16_t aRloc16);
+    static uint16_t GetExtAddressBucket(const Mac::ExtAddress &aExtAddress);
 
     uint16_t mMaxChildrenAllowed;
     Child    mChildren[kMaxChildren];
+    uint16_t mRloc16Buckets[kNumIndexBuckets];
+    uint16_t mRloc16Next[kMaxChildren];
+    uint16_t mExtAddressBuckets[kNumIndexBuckets];
+    uint16_t mExtAddressNext[kMaxChildren];
 };
 
 } // namespace ot
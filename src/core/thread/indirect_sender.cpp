@@ -77,6 +77,7 @@ void IndirectSender::Stop(void)
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
     {
         child.SetIndirectMessage(nullptr);
+        child.SetFirstQueuedMessage(nullptr);
         mSourceMatchController.ResetMessageCount(child);
     }
 
@@ -100,6 +101,7 @@ void IndirectSender::AddMessageForSleepyChild(Message &aMessage, Child &aChild)
 
     aMessage.SetChildMask(childIndex);
     mSourceMatchController.IncrementMessageCount(aChild);
+    UpdateFirstQueuedMessageOnAdd(aChild, aMessage);
 
     if ((aMessage.GetType() != Message::kTypeSupervision) && (aChild.GetIndirectMessageCount() > 1))
     {
@@ -127,6 +129,7 @@ Error IndirectSender::RemoveMessageFromSleepyChild(Message &aMessage, Child &aCh
 
     aMessage.ClearChildMask(childIndex);
     mSourceMatchController.DecrementMessageCount(aChild);
+    UpdateFirstQueuedMessageOnRemove(aChild, aMessage);
 
     RequestMessageUpdate(aChild);
 
@@ -146,6 +149,7 @@ void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
     }
 
     aChild.SetIndirectMessage(nullptr);
+    aChild.SetFirstQueuedMessage(nullptr);
     mSourceMatchController.ResetMessageCount(aChild);
 
     mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
@@ -191,6 +195,7 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
         }
 
         aChild.SetIndirectMessage(nullptr);
+        aChild.SetFirstQueuedMessage(nullptr);
         mSourceMatchController.ResetMessageCount(aChild);
 
         mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
@@ -208,16 +213,28 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
 }
 
 Message *IndirectSender::FindIndirectMessage(Child &aChild, bool aSupervisionTypeOnly)
+{
+    Message *msg = aChild.GetFirstQueuedMessage();
+
+    if (aSupervisionTypeOnly)
+    {
+        msg = FindQueuedMessage(aChild, msg, aSupervisionTypeOnly);
+    }
+
+    return msg;
+}
+
+Message *IndirectSender::FindQueuedMessage(const Child &aChild, Message *aStart, bool aSupervisionTypeOnly) const
 {
     Message *msg        = nullptr;
     uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
 
-    for (Message &message : Get<MeshForwarder>().mSendQueue)
+    for (Message *message = aStart; message != nullptr; message = message->GetNext())
     {
-        if (message.GetChildMask(childIndex) &&
-            (!aSupervisionTypeOnly || (message.GetType() == Message::kTypeSupervision)))
+        if (message->GetChildMask(childIndex) &&
+            (!aSupervisionTypeOnly || (message->GetType() == Message::kTypeSupervision)))
         {
-            msg = &message;
+            msg = message;
             break;
         }
     }
@@ -225,6 +242,36 @@ Message *IndirectSender::FindIndirectMessage(Child &aChild, bool aSupervisionTyp
     return msg;
 }
 
+void IndirectSender::UpdateFirstQueuedMessageOnAdd(Child &aChild, Message &aMessage)
+{
+    Message *firstMessage = aChild.GetFirstQueuedMessage();
+
+    // A message is added for a sleepy child right after it is
+    // enqueued in the send queue, so it follows all the queued
+    // messages with the same or higher priority. It becomes the
+    // first message for the child only when it has a higher
+    // priority than the current first one.
+
+    if ((firstMessage == nullptr) || (aMessage.GetPriority() > firstMessage->GetPriority()))
+    {
+        aChild.SetFirstQueuedMessage(&aMessage);
+    }
+}
+
+void IndirectSender::UpdateFirstQueuedMessageOnRemove(Child &aChild, Message &aMessage)
+{
+    // Must be called after the child mask bit of `aMessage` is
+    // cleared and before the message is removed from the send
+    // queue. Messages ahead of the first one have no bit set for
+    // the child, so the search continues from `aMessage`.
+
+    VerifyOrExit(aChild.GetFirstQueuedMessage() == &aMessage);
+    aChild.SetFirstQueuedMessage(FindQueuedMessage(aChild, aMessage.GetNext(), /* aSupervisionTypeOnly */ false));
+
+exit:
+    return;
+}
+
 void IndirectSender::RequestMessageUpdate(Child &aChild)
 {
     Message *curMessage = aChild.GetIndirectMessage();
@@ -534,6 +581,7 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
         {
             message->ClearChildMask(childIndex);
             mSourceMatchController.DecrementMessageCount(aChild);
+            UpdateFirstQueuedMessageOnRemove(aChild, *message);
         }
 
         Get<MeshForwarder>().RemoveMessageIfNoPendingTx(*message);
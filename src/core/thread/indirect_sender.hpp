@@ -100,6 +100,9 @@ public:
         Message *GetIndirectMessage(void) { return mIndirectMessage; }
         void     SetIndirectMessage(Message *aMessage) { mIndirectMessage = aMessage; }
 
+        Message *GetFirstQueuedMessage(void) { return mFirstQueuedMessage; }
+        void     SetFirstQueuedMessage(Message *aMessage) { mFirstQueuedMessage = aMessage; }
+
         uint16_t GetIndirectFragmentOffset(void) const { return mIndirectFragmentOffset; }
         void     SetIndirectFragmentOffset(uint16_t aFragmentOffset) { mIndirectFragmentOffset = aFragmentOffset; }
 
@@ -122,6 +125,7 @@ public:
         const Mac::Address &GetMacAddress(Mac::Address &aMacAddress) const;
 
         Message *mIndirectMessage;             // Current indirect message.
+        Message *mFirstQueuedMessage;          // First message in the send queue destined to the child.
         uint16_t mIndirectFragmentOffset : 14; // 6LoWPAN fragment offset for the indirect message.
         bool     mIndirectTxSuccess : 1;       // Indicates tx success/failure of current indirect message.
         bool     mWaitingForMessageUpdate : 1; // Indicates waiting for updating the indirect message.
@@ -210,6 +214,9 @@ private:
 
     void     UpdateIndirectMessage(Child &aChild);
     Message *FindIndirectMessage(Child &aChild, bool aSupervisionTypeOnly = false);
+    Message *FindQueuedMessage(const Child &aChild, Message *aStart, bool aSupervisionTypeOnly) const;
+    void     UpdateFirstQueuedMessageOnAdd(Child &aChild, Message &aMessage);
+    void     UpdateFirstQueuedMessageOnRemove(Child &aChild, Message &aMessage);
     void     RequestMessageUpdate(Child &aChild);
     uint16_t PrepareDataFrame(Mac::TxFrame &aFrame, Child &aChild, Message &aMessage);
     void     PrepareEmptyFrame(Mac::TxFrame &aFrame, Child &aChild, bool aAckRequest);
@@ -166,6 +166,12 @@ exit:
 KeyManager::KeyManager(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mKeySequence(0)
+    , mTemporaryMleKeySequence(0)
+    , mIsTemporaryMleKeyValid(false)
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+    , mTemporaryTrelKeySequence(0)
+    , mIsTemporaryTrelKeyValid(false)
+#endif
     , mMleFrameCounter(0)
     , mStoredMacFrameCounter(0)
     , mStoredMleFrameCounter(0)
@@ -330,6 +336,14 @@ void KeyManager::UpdateKeyMaterial(void)
 {
     HashKeys hashKeys;
 
+    // The cached temporary keys may have been derived from a
+    // different network key.
+
+    mIsTemporaryMleKeyValid = false;
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+    mIsTemporaryTrelKeyValid = false;
+#endif
+
     ComputeKeys(mKeySequence, hashKeys);
 
     mMleKey.SetFrom(hashKeys.GetMleKey());
@@ -394,9 +408,14 @@ const Mle::KeyMaterial &KeyManager::GetTemporaryMleKey(uint32_t aKeySequence)
 {
     HashKeys hashKeys;
 
+    VerifyOrExit(!mIsTemporaryMleKeyValid || (mTemporaryMleKeySequence != aKeySequence));
+
     ComputeKeys(aKeySequence, hashKeys);
     mTemporaryMleKey.SetFrom(hashKeys.GetMleKey());
+    mTemporaryMleKeySequence = aKeySequence;
+    mIsTemporaryMleKeyValid  = true;
 
+exit:
     return mTemporaryMleKey;
 }
 
@@ -405,9 +424,14 @@ const Mac::KeyMaterial &KeyManager::GetTemporaryTrelMacKey(uint32_t aKeySequence
 {
     Mac::Key key;
 
+    VerifyOrExit(!mIsTemporaryTrelKeyValid || (mTemporaryTrelKeySequence != aKeySequence));
+
     ComputeTrelKey(aKeySequence, key);
     mTemporaryTrelKey.SetFrom(key);
+    mTemporaryTrelKeySequence = aKeySequence;
+    mIsTemporaryTrelKeyValid  = true;
 
+exit:
     return mTemporaryTrelKey;
 }
 #endif
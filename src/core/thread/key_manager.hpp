@@ -340,6 +340,9 @@ public:
      *
      * @param[in]  aKeySequence  The key sequence value.
      *
+     * The last computed temporary key is cached, so it is derived only once for a burst of frames using the same key
+     * sequence (e.g., from neighbors which have not yet switched to the current key sequence).
+     *
      * @returns The temporary TREL MAC key.
      *
      */
@@ -359,6 +362,8 @@ public:
      *
      * @param[in]  aKeySequence  The key sequence value.
      *
+     * The last computed temporary key is cached, so it is derived only once for messages using the same key sequence.
+     *
      * @returns The temporary MLE key.
      *
      */
@@ -619,10 +624,14 @@ private:
     uint32_t         mKeySequence;
     Mle::KeyMaterial mMleKey;
     Mle::KeyMaterial mTemporaryMleKey;
+    uint32_t         mTemporaryMleKeySequence;
+    bool             mIsTemporaryMleKeyValid;
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     Mac::KeyMaterial mTrelKey;
     Mac::KeyMaterial mTemporaryTrelKey;
+    uint32_t         mTemporaryTrelKeySequence;
+    bool             mIsTemporaryTrelKeyValid;
 #endif
 
     Mac::LinkFrameCounters mMacFrameCounters;
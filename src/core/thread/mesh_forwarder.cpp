@@ -109,6 +109,7 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mMessageNextOffset(0)
     , mSendMessage(nullptr)
+    , mRoutedMessage(nullptr)
     , mMeshSource()
     , mMeshDest()
     , mAddMeshHeader(false)
@@ -161,8 +162,10 @@ void MeshForwarder::Stop(void)
 
     mSendQueue.DequeueAndFreeAll();
     mReassemblyList.DequeueAndFreeAll();
+    mReassemblyTable.Clear();
 
 #if OPENTHREAD_FTD
+    mResolvingQueue.DequeueAndFreeAll();
     mIndirectSender.Stop();
     mFragmentPriorityList.Clear();
 #endif
@@ -172,8 +175,9 @@ void MeshForwarder::Stop(void)
     mDelayNextTx = false;
 #endif
 
-    mEnabled     = false;
-    mSendMessage = nullptr;
+    mEnabled       = false;
+    mSendMessage   = nullptr;
+    mRoutedMessage = nullptr;
     Get<Mac::Mac>().SetRxOnWhenIdle(false);
 
 exit:
@@ -204,6 +208,16 @@ void MeshForwarder::PrepareEmptyFrame(Mac::TxFrame &aFrame, const Mac::Address &
 
 void MeshForwarder::RemoveMessage(Message &aMessage)
 {
+    LogMessage(kMessageEvict, aMessage, kErrorNoBufs);
+    DequeueAndFreeMessage(aMessage);
+}
+
+void MeshForwarder::DequeueAndFreeMessage(Message &aMessage)
+{
+    // Frees a message from its transmit queue. A message which is
+    // still pending for sleepy children is first removed from them,
+    // so that no `Child` refers to the freed message.
+
     PriorityQueue *queue = aMessage.GetPriorityQueue();
 
     OT_ASSERT(queue != nullptr);
@@ -211,10 +225,7 @@ void MeshForwarder::RemoveMessage(Message &aMessage)
     if (queue == &mSendQueue)
     {
 #if OPENTHREAD_FTD
-        for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
-        {
-            IgnoreError(mIndirectSender.RemoveMessageFromSleepyChild(aMessage, child));
-        }
+        RemoveMessageFromSleepyChildren(aMessage);
 #endif
 
         if (mSendMessage == &aMessage)
@@ -223,7 +234,10 @@ void MeshForwarder::RemoveMessage(Message &aMessage)
         }
     }
 
-    LogMessage(kMessageEvict, aMessage, kErrorNoBufs);
+#if OPENTHREAD_FTD
+    OT_ASSERT(!aMessage.IsChildPending());
+#endif
+
     queue->DequeueAndFree(aMessage);
 }
 
@@ -402,10 +416,24 @@ Error MeshForwarder::RemoveAgedMessages(void)
     // messages. It returns `kErrorNone` if at least one message was
     // removed, or `kErrorNotFound` if none was removed.
 
+    Error error = RemoveAgedMessages(mSendQueue);
+
+#if OPENTHREAD_FTD
+    if (RemoveAgedMessages(mResolvingQueue) == kErrorNone)
+    {
+        error = kErrorNone;
+    }
+#endif
+
+    return error;
+}
+
+Error MeshForwarder::RemoveAgedMessages(PriorityQueue &aQueue)
+{
     Error    error = kErrorNotFound;
     Message *nextMessage;
 
-    for (Message *message = mSendQueue.GetHead(); message != nullptr; message = nextMessage)
+    for (Message *message = aQueue.GetHead(); message != nullptr; message = nextMessage)
     {
         nextMessage = message->GetNext();
 
@@ -429,10 +457,21 @@ Error MeshForwarder::RemoveAgedMessages(void)
 #if (OPENTHREAD_CONFIG_MAX_FRAMES_IN_DIRECT_TX_QUEUE > 0)
 
 bool MeshForwarder::IsDirectTxQueueOverMaxFrameThreshold(void) const
+{
+    uint16_t frameCount = EstimateDirectTxFrameCount(mSendQueue);
+
+#if OPENTHREAD_FTD
+    frameCount += EstimateDirectTxFrameCount(mResolvingQueue);
+#endif
+
+    return (frameCount > OPENTHREAD_CONFIG_MAX_FRAMES_IN_DIRECT_TX_QUEUE);
+}
+
+uint16_t MeshForwarder::EstimateDirectTxFrameCount(const PriorityQueue &aQueue) const
 {
     uint16_t frameCount = 0;
 
-    for (const Message &message : mSendQueue)
+    for (const Message &message : aQueue)
     {
         if (!message.IsDirectTransmission() || (&message == mSendMessage))
         {
@@ -484,7 +523,7 @@ bool MeshForwarder::IsDirectTxQueueOverMaxFrameThreshold(void) const
         }
     }
 
-    return (frameCount > OPENTHREAD_CONFIG_MAX_FRAMES_IN_DIRECT_TX_QUEUE);
+    return frameCount;
 }
 
 void MeshForwarder::ApplyDirectTxQueueLimit(Message &aMessage)
@@ -542,6 +581,23 @@ void MeshForwarder::TxQueueStats::UpdateFor(const Message &aMessage)
     mHistogram[Min<uint32_t>(timeInQueue / kHistBinInterval, kNumHistBins - 1)]++;
     mMaxInterval = Max(mMaxInterval, timeInQueue);
 }
+
+#if OPENTHREAD_FTD
+void MeshForwarder::TxQueueStats::UpdateResolvingQueueLength(const PriorityQueue &aResolvingQueue)
+{
+    PriorityQueue::Info info;
+
+    memset(&info, 0, sizeof(info));
+    aResolvingQueue.GetInfo(info);
+
+    mMaxResolvingQueueLength = Max(mMaxResolvingQueueLength, info.mNumMessages);
+}
+
+void MeshForwarder::TxQueueStats::UpdateResolvingIntervalFor(const Message &aMessage)
+{
+    mMaxResolvingInterval = Max<uint32_t>(mMaxResolvingInterval, TimerMilli::GetNow() - aMessage.GetTimestamp());
+}
+#endif
 #endif
 
 void MeshForwarder::ScheduleTransmissionTask(void)
@@ -580,6 +636,11 @@ Message *MeshForwarder::PrepareNextDirectTransmission(void)
 
         nextMessage = curMessage->GetNext();
 
+        // Messages awaiting address resolution are normally parked in
+        // `mResolvingQueue`. Messages pending only indirect tx to sleepy
+        // children stay in `mSendQueue`, where `IndirectSender` looks
+        // them up, so they are still skipped here one at a time.
+
         if (!curMessage->IsDirectTransmission() || curMessage->IsResolvingAddress())
         {
             continue;
@@ -623,6 +684,12 @@ Message *MeshForwarder::PrepareNextDirectTransmission(void)
         // the next message may have been evicted during processing (e.g. due to Address Solicit)
         nextMessage = curMessage->GetNext();
 
+        // Remember which message the route info (`mMacAddrs` and
+        // mesh header fields) was determined for, so that it can be
+        // reused for its next fragments.
+
+        mRoutedMessage = (error == kErrorNone) ? curMessage : nullptr;
+
         switch (error)
         {
         case kErrorNone:
@@ -633,7 +700,7 @@ Message *MeshForwarder::PrepareNextDirectTransmission(void)
 
 #if OPENTHREAD_FTD
         case kErrorAddressQuery:
-            curMessage->SetResolvingAddress(true);
+            ParkResolvingMessage(*curMessage);
             continue;
 #endif
 
@@ -642,7 +709,7 @@ Message *MeshForwarder::PrepareNextDirectTransmission(void)
             mTxQueueStats.UpdateFor(*curMessage);
 #endif
             LogMessage(kMessageDrop, *curMessage, error);
-            mSendQueue.DequeueAndFree(*curMessage);
+            DequeueAndFreeMessage(*curMessage);
             continue;
         }
     }
@@ -657,6 +724,23 @@ Error MeshForwarder::UpdateIp6Route(Message &aMessage)
     Error           error = kErrorNone;
     Ip6::Header     ip6Header;
 
+    if ((aMessage.GetOffset() > 0) && (&aMessage == mRoutedMessage))
+    {
+        // This is a next fragment of the same datagram as the last
+        // routed message, so the route info is still valid. Only the
+        // next hop towards the mesh destination is updated, and the
+        // IPv6 header is not read again.
+
+#if OPENTHREAD_FTD
+        if (mAddMeshHeader)
+        {
+            mMacAddrs.mDestination.SetShort(mle.GetNextHop(mMeshDest));
+            VerifyOrExit(!mMacAddrs.mDestination.IsShortAddrInvalid(), error = kErrorDrop);
+        }
+#endif
+        ExitNow();
+    }
+
     mAddMeshHeader = false;
 
     IgnoreError(aMessage.Read(0, ip6Header));
@@ -1346,7 +1430,7 @@ void MeshForwarder::RemoveMessageIfNoPendingTx(Message &aMessage)
         mMessageNextOffset = 0;
     }
 
-    mSendQueue.DequeueAndFree(aMessage);
+    DequeueAndFreeMessage(aMessage);
 
 exit:
     return;
@@ -1416,9 +1500,10 @@ void MeshForwarder::HandleFragment(FrameData            &aFrameData,
                                    const Mac::Addresses &aMacAddrs,
                                    const ThreadLinkInfo &aLinkInfo)
 {
-    Error                  error = kErrorNone;
-    Lowpan::FragmentHeader fragmentHeader;
-    Message               *message = nullptr;
+    Error                   error = kErrorNone;
+    Lowpan::FragmentHeader  fragmentHeader;
+    Message                *message = nullptr;
+    ReassemblyTable::Entry *entry   = nullptr;
 
     SuccessOrExit(error = fragmentHeader.ParseFrom(aFrameData));
 
@@ -1489,23 +1574,46 @@ void MeshForwarder::HandleFragment(FrameData            &aFrameData,
             ClearReassemblyList();
         }
 
+        entry = mReassemblyTable.FindEntry(aMacAddrs.mSource, fragmentHeader.GetDatagramTag(), datagramSize);
+
+        if (entry != nullptr)
+        {
+            // A repeated first fragment of a datagram under reassembly
+            // (e.g., the sender retransmitting the datagram) restarts
+            // its reassembly.
+
+            mReassemblyList.DequeueAndFree(*entry->GetMessage());
+        }
+        else
+        {
+            entry = &mReassemblyTable.GetEntryToAllocate();
+
+            if (entry->IsInUse())
+            {
+                RemoveReassemblyEntry(*entry, kErrorNoBufs);
+            }
+        }
+
+        entry->Init(*message, aMacAddrs.mSource, fragmentHeader.GetDatagramTag(), datagramSize);
         mReassemblyList.Enqueue(*message);
 
         Get<TimeTicker>().RegisterReceiver(TimeTicker::kMeshForwarder);
     }
     else // Received frame is a "next fragment".
     {
-        for (Message &msg : mReassemblyList)
+        entry = mReassemblyTable.FindEntry(aMacAddrs.mSource, fragmentHeader.GetDatagramTag(),
+                                           fragmentHeader.GetDatagramSize());
+
+        if (entry != nullptr)
         {
+            Message &msg = *entry->GetMessage();
+
             // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
-            if (msg.GetLength() == fragmentHeader.GetDatagramSize() &&
-                msg.GetDatagramTag() == fragmentHeader.GetDatagramTag() &&
-                msg.GetOffset() == fragmentHeader.GetDatagramOffset() &&
+            if (msg.GetOffset() == fragmentHeader.GetDatagramOffset() &&
                 msg.GetOffset() + aFrameData.GetLength() <= fragmentHeader.GetDatagramSize() &&
                 msg.IsLinkSecurityEnabled() == aLinkInfo.IsLinkSecurityEnabled())
             {
                 message = &msg;
-                break;
             }
         }
 
@@ -1529,6 +1637,7 @@ void MeshForwarder::HandleFragment(FrameData            &aFrameData,
         message->AddLqi(aLinkInfo.GetLqi());
 #endif
         message->SetTimestampToNow();
+        entry->ResetExpireTime();
     }
 
 exit:
@@ -1537,6 +1646,7 @@ exit:
     {
         if (message->GetOffset() >= message->GetLength())
         {
+            entry->Clear();
             mReassemblyList.Dequeue(*message);
             IgnoreError(HandleDatagram(*message, aLinkInfo, aMacAddrs.mSource));
         }
@@ -1551,17 +1661,40 @@ exit:
 
 void MeshForwarder::ClearReassemblyList(void)
 {
-    for (Message &message : mReassemblyList)
+    for (ReassemblyTable::Entry &entry : mReassemblyTable)
     {
-        LogMessage(kMessageReassemblyDrop, message, kErrorNoFrameReceived);
-
-        if (message.GetType() == Message::kTypeIp6)
+        if (entry.IsInUse())
         {
-            mIpCounters.mRxFailure++;
+            RemoveReassemblyEntry(entry, kErrorNoFrameReceived);
         }
+    }
+}
+
+void MeshForwarder::RemoveReassemblyEntry(ReassemblyTable::Entry &aEntry, Error aError)
+{
+    Message &message = *aEntry.GetMessage();
+
+    LogMessage(kMessageReassemblyDrop, message, aError);
 
-        mReassemblyList.DequeueAndFree(message);
+    if (message.GetType() == Message::kTypeIp6)
+    {
+        mIpCounters.mRxFailure++;
     }
+
+    mReassemblyList.DequeueAndFree(message);
+    aEntry.Clear();
+}
+
+Error MeshForwarder::EvictReassemblyMessage(Message::Priority aPriority)
+{
+    Error                   error = kErrorNone;
+    ReassemblyTable::Entry *entry = mReassemblyTable.FindEntryToEvict(aPriority);
+
+    VerifyOrExit(entry != nullptr, error = kErrorNotFound);
+    RemoveReassemblyEntry(*entry, kErrorNoBufs);
+
+exit:
+    return error;
 }
 
 void MeshForwarder::HandleTimeTick(void)
@@ -1582,24 +1715,134 @@ void MeshForwarder::HandleTimeTick(void)
 
 bool MeshForwarder::UpdateReassemblyList(void)
 {
-    TimeMilli now = TimerMilli::GetNow();
+    TimeMilli now        = TimerMilli::GetNow();
+    bool      hasEntries = false;
 
-    for (Message &message : mReassemblyList)
+    for (ReassemblyTable::Entry &entry : mReassemblyTable)
     {
-        if (now - message.GetTimestamp() >= TimeMilli::SecToMsec(kReassemblyTimeout))
+        if (!entry.IsInUse())
         {
-            LogMessage(kMessageReassemblyDrop, message, kErrorReassemblyTimeout);
+            continue;
+        }
 
-            if (message.GetType() == Message::kTypeIp6)
-            {
-                mIpCounters.mRxFailure++;
-            }
+        if (now >= entry.GetExpireTime())
+        {
+            RemoveReassemblyEntry(entry, kErrorReassemblyTimeout);
+        }
+        else
+        {
+            hasEntries = true;
+        }
+    }
+
+    return hasEntries;
+}
+
+void MeshForwarder::ReassemblyTable::Entry::Init(Message            &aMessage,
+                                                 const Mac::Address &aSource,
+                                                 uint16_t            aTag,
+                                                 uint16_t            aSize)
+{
+    mMessage = &aMessage;
+    mSource  = aSource;
+    mTag     = aTag;
+    mSize    = aSize;
+    ResetExpireTime();
+}
+
+void MeshForwarder::ReassemblyTable::Entry::ResetExpireTime(void)
+{
+    mExpireTime = TimerMilli::GetNow() + TimeMilli::SecToMsec(kReassemblyTimeout);
+}
 
-            mReassemblyList.DequeueAndFree(message);
+MeshForwarder::ReassemblyTable::Entry *MeshForwarder::ReassemblyTable::FindEntry(const Mac::Address &aSource,
+                                                                                 uint16_t            aTag,
+                                                                                 uint16_t            aSize)
+{
+    Entry *rval = nullptr;
+
+    for (Entry &entry : mEntries)
+    {
+        if (entry.IsInUse() && entry.Matches(aSource, aTag, aSize))
+        {
+            rval = &entry;
+            break;
+        }
+    }
+
+    return rval;
+}
+
+MeshForwarder::ReassemblyTable::Entry &MeshForwarder::ReassemblyTable::GetEntryToAllocate(void)
+{
+    // Returns a free entry, or the oldest entry if the table is full.
+    // The caller must remove the current message of a returned in-use
+    // entry.
+
+    Entry *rval = nullptr;
+
+    for (Entry &entry : mEntries)
+    {
+        if (!entry.IsInUse())
+        {
+            ExitNow(rval = &entry);
+        }
+
+        if ((rval == nullptr) || (entry.mExpireTime < rval->mExpireTime))
+        {
+            rval = &entry;
+        }
+    }
+
+exit:
+    return *rval;
+}
+
+MeshForwarder::ReassemblyTable::Entry *MeshForwarder::ReassemblyTable::FindEntryToEvict(Message::Priority aPriority)
+{
+    // Finds the oldest datagram of the source holding the most
+    // reassembly buffers, among the ones with a priority not higher
+    // than `aPriority`. This is only used when message buffers run
+    // out, so the quadratic search is acceptable.
+
+    Entry   *rval      = nullptr;
+    uint32_t maxLength = 0;
+
+    for (Entry &entry : mEntries)
+    {
+        uint32_t length;
+
+        if (!entry.IsInUse() || (entry.mMessage->GetPriority() > aPriority))
+        {
+            continue;
+        }
+
+        length = GetSourceLength(entry.mSource);
+
+        if ((rval == nullptr) || (length > maxLength) ||
+            ((length == maxLength) && (entry.mExpireTime < rval->mExpireTime)))
+        {
+            rval      = &entry;
+            maxLength = length;
+        }
+    }
+
+    return rval;
+}
+
+uint32_t MeshForwarder::ReassemblyTable::GetSourceLength(const Mac::Address &aSource) const
+{
+    uint32_t length = 0;
+
+    for (const Entry &entry : mEntries)
+    {
+        if (entry.IsInUse() && (entry.mSource == aSource))
+        {
+            length += entry.mMessage->GetLength();
         }
     }
 
-    return mReassemblyList.GetHead() != nullptr;
+    return length;
 }
 
 Error MeshForwarder::FrameToMessage(const FrameData      &aFrameData,
@@ -273,6 +273,9 @@ public:
     /**
      * Evicts the message with lowest priority in the send queue.
      *
+     * If there is none to evict, a datagram under reassembly is dropped instead, the oldest one from the neighbor
+     * holding the most reassembly buffers.
+     *
      * @param[in]  aPriority  The highest priority level of the evicted message.
      *
      * @retval kErrorNone       Successfully evicted a low priority message.
@@ -289,6 +292,19 @@ public:
      */
     const PriorityQueue &GetSendQueue(void) const { return mSendQueue; }
 
+#if OPENTHREAD_FTD
+    /**
+     * Returns a reference to the resolving queue.
+     *
+     * The resolving queue holds direct messages which are waiting for address resolution to complete. They are moved
+     * back to the send queue once `HandleResolved()` is called for their destination.
+     *
+     * @returns  A reference to the resolving queue.
+     *
+     */
+    const PriorityQueue &GetResolvingQueue(void) const { return mResolvingQueue; }
+#endif
+
     /**
      * Returns a reference to the reassembly queue.
      *
@@ -353,6 +369,31 @@ public:
      */
     uint32_t GetMaxTimeInQueue(void) const { return mTxQueueStats.GetMaxInterval(); }
 
+#if OPENTHREAD_FTD
+    /**
+     * Gets the maximum number of messages held in the resolving queue at the same time.
+     *
+     * The collected statistics can be reset by calling `ResetTimeInQueueStat()`.
+     *
+     * @returns The maximum resolving queue length (so far).
+     *
+     */
+    uint16_t GetMaxResolvingQueueLength(void) const { return mTxQueueStats.GetMaxResolvingQueueLength(); }
+
+    /**
+     * Gets the maximum time a message was held back from transmission waiting for address resolution.
+     *
+     * The time is measured as the duration from when a message is added to the transmit queue until its address
+     * resolution completes (successfully or not).
+     *
+     * The collected statistics can be reset by calling `ResetTimeInQueueStat()`.
+     *
+     * @returns The maximum address resolution hold time in milliseconds (so far).
+     *
+     */
+    uint32_t GetMaxResolvingInterval(void) const { return mTxQueueStats.GetMaxResolvingInterval(); }
+#endif
+
     /**
      * Resets the TX queue time-in-queue statistics.
      *
@@ -423,6 +464,53 @@ private:
         kAnycastService,
     };
 
+    class ReassemblyTable : public Clearable<ReassemblyTable>
+    {
+        // Indexes the messages in `mReassemblyList` by the source MAC
+        // address, datagram tag and datagram size of the fragments.
+
+    public:
+        class Entry : public Clearable<Entry>
+        {
+            friend class ReassemblyTable;
+
+        public:
+            void      Init(Message &aMessage, const Mac::Address &aSource, uint16_t aTag, uint16_t aSize);
+            bool      IsInUse(void) const { return (mMessage != nullptr); }
+            Message  *GetMessage(void) const { return mMessage; }
+            TimeMilli GetExpireTime(void) const { return mExpireTime; }
+            void      ResetExpireTime(void);
+
+        private:
+            bool Matches(const Mac::Address &aSource, uint16_t aTag, uint16_t aSize) const
+            {
+                return (mTag == aTag) && (mSize == aSize) && (mSource == aSource);
+            }
+
+            Message     *mMessage;
+            TimeMilli    mExpireTime;
+            Mac::Address mSource;
+            uint16_t     mTag;
+            uint16_t     mSize;
+        };
+
+        Entry *FindEntry(const Mac::Address &aSource, uint16_t aTag, uint16_t aSize);
+        Entry &GetEntryToAllocate(void);
+        Entry *FindEntryToEvict(Message::Priority aPriority);
+
+        Entry *begin(void) { return &mEntries[0]; }
+        Entry *end(void) { return &mEntries[kNumEntries]; }
+
+    private:
+        static constexpr uint16_t kNumEntries = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_NUM_ENTRIES;
+
+        static_assert(kNumEntries > 0, "NUM_ENTRIES must be non-zero");
+
+        uint32_t GetSourceLength(const Mac::Address &aSource) const;
+
+        Entry mEntries[kNumEntries];
+    };
+
 #if OPENTHREAD_FTD
     class FragmentPriorityList : public Clearable<FragmentPriorityList>
     {
@@ -491,6 +579,12 @@ private:
         const uint32_t *GetHistogram(uint16_t &aNumBins, uint32_t &aBinInterval) const;
         uint32_t        GetMaxInterval(void) const { return mMaxInterval; }
         void            UpdateFor(const Message &aMessage);
+#if OPENTHREAD_FTD
+        uint16_t GetMaxResolvingQueueLength(void) const { return mMaxResolvingQueueLength; }
+        uint32_t GetMaxResolvingInterval(void) const { return mMaxResolvingInterval; }
+        void     UpdateResolvingQueueLength(const PriorityQueue &aResolvingQueue);
+        void     UpdateResolvingIntervalFor(const Message &aMessage);
+#endif
 
     private:
         static constexpr uint32_t kHistMaxInterval = OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_HISTOGRAM_MAX_INTERVAL;
@@ -499,6 +593,10 @@ private:
 
         uint32_t mMaxInterval;
         uint32_t mHistogram[kNumHistBins];
+#if OPENTHREAD_FTD
+        uint16_t mMaxResolvingQueueLength;
+        uint32_t mMaxResolvingInterval;
+#endif
     };
 #endif
 
@@ -536,12 +634,17 @@ private:
 #if OPENTHREAD_CONFIG_DELAY_AWARE_QUEUE_MANAGEMENT_ENABLE
     Error UpdateEcnOrDrop(Message &aMessage, bool aPreparingToSend);
     Error RemoveAgedMessages(void);
+    Error RemoveAgedMessages(PriorityQueue &aQueue);
 #endif
 #if (OPENTHREAD_CONFIG_MAX_FRAMES_IN_DIRECT_TX_QUEUE > 0)
-    bool IsDirectTxQueueOverMaxFrameThreshold(void) const;
-    void ApplyDirectTxQueueLimit(Message &aMessage);
+    bool     IsDirectTxQueueOverMaxFrameThreshold(void) const;
+    uint16_t EstimateDirectTxFrameCount(const PriorityQueue &aQueue) const;
+    void     ApplyDirectTxQueueLimit(Message &aMessage);
 #endif
     void  SendMesh(Message &aMessage, Mac::TxFrame &aFrame);
+    void  ParkResolvingMessage(Message &aMessage);
+    void  RemoveMessageFromSleepyChildren(Message &aMessage);
+    bool  HandleResolved(Message &aMessage, const Ip6::Address &aEid, Error aError);
     void  SendDestinationUnreachable(uint16_t aMeshSource, const Ip6::Headers &aIp6Headers);
     Error UpdateIp6Route(Message &aMessage);
     Error UpdateIp6RouteFtd(const Ip6::Header &aIp6Header, Message &aMessage);
@@ -549,6 +652,8 @@ private:
     Error AnycastRouteLookup(uint8_t aServiceId, AnycastType aType, uint16_t &aMeshDest) const;
     Error UpdateMeshRoute(Message &aMessage);
     bool  UpdateReassemblyList(void);
+    void  RemoveReassemblyEntry(ReassemblyTable::Entry &aEntry, Error aError);
+    Error EvictReassemblyMessage(Message::Priority aPriority);
     void  UpdateFragmentPriority(Lowpan::FragmentHeader &aFragmentHeader,
                                  uint16_t                aFragmentLength,
                                  uint16_t                aSrcRloc16,
@@ -556,6 +661,7 @@ private:
     Error HandleDatagram(Message &aMessage, const ThreadLinkInfo &aLinkInfo, const Mac::Address &aMacSource);
     void  ClearReassemblyList(void);
     void  RemoveMessage(Message &aMessage);
+    void  DequeueAndFreeMessage(Message &aMessage);
     void  HandleDiscoverComplete(void);
 
     void          HandleReceivedFrame(Mac::RxFrame &aFrame);
@@ -641,11 +747,17 @@ private:
 #endif
 
     PriorityQueue mSendQueue;
+#if OPENTHREAD_FTD
+    PriorityQueue mResolvingQueue;
+#endif
     MessageQueue  mReassemblyList;
     uint16_t      mFragTag;
     uint16_t      mMessageNextOffset;
 
+    ReassemblyTable mReassemblyTable;
+
     Message *mSendMessage;
+    Message *mRoutedMessage;
 
     Mac::Addresses mMacAddrs;
     uint16_t       mMeshSource;
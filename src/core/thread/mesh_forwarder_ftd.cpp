@@ -144,66 +144,129 @@ Error MeshForwarder::SendMessage(Message &aMessage)
     return error;
 }
 
+void MeshForwarder::ParkResolvingMessage(Message &aMessage)
+{
+    // Moves a direct message waiting for address resolution out of
+    // `mSendQueue` so that `PrepareNextDirectTransmission()` does
+    // not need to step over it until `HandleResolved()` is called.
+    // A message which is also pending indirect transmission to a
+    // sleepy child stays in `mSendQueue` (where `IndirectSender`
+    // expects it) and is only marked as resolving.
+
+    aMessage.SetResolvingAddress(true);
+
+    VerifyOrExit(!aMessage.IsChildPending());
+
+    mSendQueue.Dequeue(aMessage);
+    mResolvingQueue.Enqueue(aMessage);
+
+#if OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_ENABLE
+    mTxQueueStats.UpdateResolvingQueueLength(mResolvingQueue);
+#endif
+
+exit:
+    return;
+}
+
+void MeshForwarder::RemoveMessageFromSleepyChildren(Message &aMessage)
+{
+    VerifyOrExit(aMessage.IsChildPending());
+
+    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
+    {
+        IgnoreError(mIndirectSender.RemoveMessageFromSleepyChild(aMessage, child));
+    }
+
+exit:
+    return;
+}
+
 void MeshForwarder::HandleResolved(const Ip6::Address &aEid, Error aError)
 {
-    Ip6::Address ip6Dst;
-    bool         didUpdate = false;
+    bool didUpdate = false;
+
+    for (Message &message : mResolvingQueue)
+    {
+        didUpdate |= HandleResolved(message, aEid, aError);
+    }
 
     for (Message &message : mSendQueue)
     {
-        if (!message.IsResolvingAddress())
+        if (message.IsResolvingAddress())
         {
-            continue;
+            didUpdate |= HandleResolved(message, aEid, aError);
         }
+    }
 
-        IgnoreError(message.Read(Ip6::Header::kDestinationFieldOffset, ip6Dst));
+    if (didUpdate)
+    {
+        mScheduleTransmissionTask.Post();
+    }
+}
 
-        if (ip6Dst != aEid)
-        {
-            continue;
-        }
+bool MeshForwarder::HandleResolved(Message &aMessage, const Ip6::Address &aEid, Error aError)
+{
+    // Returns `true` if `aMessage` was released for transmission.
 
-        if (aError != kErrorNone)
-        {
-            LogMessage(kMessageDrop, message, kErrorAddressQuery);
-            mSendQueue.DequeueAndFree(message);
-            continue;
-        }
+    PriorityQueue &queue     = *aMessage.GetPriorityQueue();
+    bool           didUpdate = false;
+    Ip6::Address   ip6Dst;
+
+    IgnoreError(aMessage.Read(Ip6::Header::kDestinationFieldOffset, ip6Dst));
+
+    VerifyOrExit(ip6Dst == aEid);
+
+#if OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_ENABLE
+    mTxQueueStats.UpdateResolvingIntervalFor(aMessage);
+#endif
+
+    if (aError != kErrorNone)
+    {
+        LogMessage(kMessageDrop, aMessage, kErrorAddressQuery);
+        DequeueAndFreeMessage(aMessage);
+        ExitNow();
+    }
 
 #if OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
-        // Pass back to IPv6 layer for DUA destination resolved
-        // by Backbone Query
-        if (Get<BackboneRouter::Local>().IsPrimary() && Get<BackboneRouter::Leader>().IsDomainUnicast(ip6Dst) &&
-            Get<AddressResolver>().LookUp(ip6Dst) == Get<Mle::MleRouter>().GetRloc16())
-        {
-            uint8_t hopLimit;
+    // Pass back to IPv6 layer for DUA destination resolved
+    // by Backbone Query
+    if (Get<BackboneRouter::Local>().IsPrimary() && Get<BackboneRouter::Leader>().IsDomainUnicast(ip6Dst) &&
+        Get<AddressResolver>().LookUp(ip6Dst) == Get<Mle::MleRouter>().GetRloc16())
+    {
+        uint8_t hopLimit;
 
-            mSendQueue.Dequeue(message);
+        RemoveMessageFromSleepyChildren(aMessage);
+        queue.Dequeue(aMessage);
 
-            // Avoid decreasing Hop Limit twice
-            IgnoreError(message.Read(Ip6::Header::kHopLimitFieldOffset, hopLimit));
-            hopLimit++;
-            message.Write(Ip6::Header::kHopLimitFieldOffset, hopLimit);
+        // Avoid decreasing Hop Limit twice
+        IgnoreError(aMessage.Read(Ip6::Header::kHopLimitFieldOffset, hopLimit));
+        hopLimit++;
+        aMessage.Write(Ip6::Header::kHopLimitFieldOffset, hopLimit);
 
-            IgnoreError(Get<Ip6::Ip6>().HandleDatagram(message, Ip6::Ip6::kFromHostAllowLoopBack));
-            continue;
-        }
+        IgnoreError(Get<Ip6::Ip6>().HandleDatagram(aMessage, Ip6::Ip6::kFromHostAllowLoopBack));
+        ExitNow();
+    }
 #endif
 
-        message.SetResolvingAddress(false);
-        didUpdate = true;
-    }
+    aMessage.SetResolvingAddress(false);
 
-    if (didUpdate)
+    if (&queue == &mResolvingQueue)
     {
-        mScheduleTransmissionTask.Post();
+        mResolvingQueue.Dequeue(aMessage);
+        mSendQueue.Enqueue(aMessage);
     }
+
+    didUpdate = true;
+
+exit:
+    return didUpdate;
 }
 
 Error MeshForwarder::EvictMessage(Message::Priority aPriority)
 {
-    Error    error = kErrorNotFound;
-    Message *evict = nullptr;
+    Error          error    = kErrorNotFound;
+    Message       *evict    = nullptr;
+    PriorityQueue *queues[] = {&mSendQueue, &mResolvingQueue};
 
 #if OPENTHREAD_CONFIG_DELAY_AWARE_QUEUE_MANAGEMENT_ENABLE
     error = RemoveAgedMessages();
@@ -213,22 +276,25 @@ Error MeshForwarder::EvictMessage(Message::Priority aPriority)
     // Search for a lower priority message to evict
     for (uint8_t priority = 0; priority < aPriority; priority++)
     {
-        for (Message *message = mSendQueue.GetHeadForPriority(static_cast<Message::Priority>(priority)); message;
-             message          = message->GetNext())
+        for (PriorityQueue *queue : queues)
         {
-            if (message->GetPriority() != priority)
+            for (Message *message = queue->GetHeadForPriority(static_cast<Message::Priority>(priority)); message;
+                 message          = message->GetNext())
             {
-                break;
-            }
+                if (message->GetPriority() != priority)
+                {
+                    break;
+                }
 
-            if (message->GetDoNotEvict())
-            {
-                continue;
-            }
+                if (message->GetDoNotEvict())
+                {
+                    continue;
+                }
 
-            evict = message;
-            error = kErrorNone;
-            ExitNow();
+                evict = message;
+                error = kErrorNone;
+                ExitNow();
+            }
         }
     }
 
@@ -255,6 +321,9 @@ Error MeshForwarder::EvictMessage(Message::Priority aPriority)
         }
     }
 
+    // Otherwise, drop a partially reassembled datagram.
+    error = EvictReassemblyMessage(aPriority);
+
 exit:
     if ((error == kErrorNone) && (evict != nullptr))
     {
@@ -316,8 +385,6 @@ void MeshForwarder::RemoveMessages(Child &aChild, Message::SubType aSubType)
 
 void MeshForwarder::RemoveDataResponseMessages(void)
 {
-    Ip6::Header ip6Header;
-
     for (Message &message : mSendQueue)
     {
         if (message.GetSubType() != Message::kSubTypeMleDataResponse)
@@ -325,23 +392,8 @@ void MeshForwarder::RemoveDataResponseMessages(void)
             continue;
         }
 
-        IgnoreError(message.Read(0, ip6Header));
-
-        if (!(ip6Header.GetDestination().IsMulticast()))
-        {
-            for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
-            {
-                IgnoreError(mIndirectSender.RemoveMessageFromSleepyChild(message, child));
-            }
-        }
-
-        if (mSendMessage == &message)
-        {
-            mSendMessage = nullptr;
-        }
-
         LogMessage(kMessageDrop, message);
-        mSendQueue.DequeueAndFree(message);
+        DequeueAndFreeMessage(message);
     }
 }
 
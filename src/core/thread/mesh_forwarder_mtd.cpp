@@ -64,14 +64,16 @@ Error MeshForwarder::EvictMessage(Message::Priority aPriority)
     VerifyOrExit(error == kErrorNotFound);
 #endif
 
-    VerifyOrExit((message = mSendQueue.GetTail()) != nullptr);
+    message = mSendQueue.GetTail();
 
-    if (message->GetPriority() < static_cast<uint8_t>(aPriority))
+    if ((message != nullptr) && (message->GetPriority() < static_cast<uint8_t>(aPriority)))
     {
         RemoveMessage(*message);
         ExitNow(error = kErrorNone);
     }
 
+    error = EvictReassemblyMessage(aPriority);
+
 exit:
     return error;
 }
@@ -45,8 +45,17 @@ namespace ot {
 void Neighbor::SetState(State aState)
 {
     VerifyOrExit(mState != aState);
+
+#if OPENTHREAD_FTD
+    Get<ChildTable>().RemoveFromIndex(*this);
+#endif
+
     mState = static_cast<uint8_t>(aState);
 
+#if OPENTHREAD_FTD
+    Get<ChildTable>().AddToIndex(*this);
+#endif
+
 #if OPENTHREAD_CONFIG_UPTIME_ENABLE
     if (mState == kStateValid)
     {
@@ -58,6 +67,32 @@ exit:
     return;
 }
 
+void Neighbor::SetExtAddress(const Mac::ExtAddress &aAddress)
+{
+#if OPENTHREAD_FTD
+    Get<ChildTable>().RemoveFromIndex(*this);
+#endif
+
+    mMacAddr = aAddress;
+
+#if OPENTHREAD_FTD
+    Get<ChildTable>().AddToIndex(*this);
+#endif
+}
+
+void Neighbor::SetRloc16(uint16_t aRloc16)
+{
+#if OPENTHREAD_FTD
+    Get<ChildTable>().RemoveFromIndex(*this);
+#endif
+
+    mRloc16 = aRloc16;
+
+#if OPENTHREAD_FTD
+    Get<ChildTable>().AddToIndex(*this);
+#endif
+}
+
 #if OPENTHREAD_CONFIG_UPTIME_ENABLE
 uint32_t Neighbor::GetConnectionTime(void) const
 {
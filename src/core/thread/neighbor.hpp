@@ -375,6 +375,9 @@ public:
     /**
      * Returns the Extended Address.
      *
+     * The returned reference MUST NOT be used to change the address of a child entry, use `SetExtAddress()` instead
+     * so that the `ChildTable` lookup index is kept up to date.
+     *
      * @returns A reference to the Extended Address.
      *
      */
@@ -386,7 +389,7 @@ public:
      * @param[in]  aAddress  The Extended Address value to set.
      *
      */
-    void SetExtAddress(const Mac::ExtAddress &aAddress) { mMacAddr = aAddress; }
+    void SetExtAddress(const Mac::ExtAddress &aAddress);
 
     /**
      * Gets the key sequence value.
@@ -499,7 +502,7 @@ public:
      * @param[in]  aRloc16  The RLOC16 value.
      *
      */
-    void SetRloc16(uint16_t aRloc16) { mRloc16 = aRloc16; }
+    void SetRloc16(uint16_t aRloc16);
 
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     /**
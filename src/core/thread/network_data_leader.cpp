@@ -113,32 +113,94 @@ Error LeaderBase::GetPreferredNat64Prefix(ExternalRouteConfig &aConfig) const
     return error;
 }
 
-const PrefixTlv *LeaderBase::FindNextMatchingPrefixTlv(const Ip6::Address &aAddress, const PrefixTlv *aPrevTlv) const
+const PrefixTlv &LeaderBase::GetPrefixTlv(const PrefixEntry &aEntry) const
 {
-    // This method iterates over Prefix TLVs which match a given IPv6
-    // `aAddress`. If `aPrevTlv` is `nullptr` we start from the
-    // beginning. Otherwise, we search for a match after `aPrevTlv`.
-    // This method returns a pointer to the next matching Prefix TLV
-    // when found, or `nullptr` if no match is found.
+    return *reinterpret_cast<const PrefixTlv *>(&mTlvBuffer[aEntry.mOffset]);
+}
+
+const LeaderBase::PrefixEntry *LeaderBase::FindNextMatchingPrefix(const Ip6::Address &aAddress,
+                                                                  const PrefixEntry  *aPrevEntry,
+                                                                  uint8_t             aFlags) const
+{
+    // This method iterates over Prefix entries which match a given
+    // IPv6 `aAddress` and contain all of the given `aFlags`. If
+    // `aPrevEntry` is `nullptr` we start from the beginning.
+    // Otherwise, we search for a match after `aPrevEntry`. This
+    // method returns a pointer to the next matching entry when found,
+    // or `nullptr` if no match is found.
+
+    const PrefixEntry *entry = (aPrevEntry == nullptr) ? mPrefixEntries.begin() : aPrevEntry + 1;
+
+    for (; entry < mPrefixEntries.end(); entry++)
+    {
+        const PrefixTlv &prefixTlv = GetPrefixTlv(*entry);
+
+        if (entry->HasFlags(aFlags) && aAddress.MatchesPrefix(prefixTlv.GetPrefix(), prefixTlv.GetPrefixLength()))
+        {
+            ExitNow();
+        }
+    }
 
+    entry = nullptr;
+
+exit:
+    return entry;
+}
+
+void LeaderBase::UpdatePrefixEntries(void)
+{
+    TlvIterator      tlvIterator(GetTlvsStart(), GetTlvsEnd());
     const PrefixTlv *prefixTlv;
-    TlvIterator      tlvIterator((aPrevTlv == nullptr) ? GetTlvsStart() : aPrevTlv->GetNext(), GetTlvsEnd());
+
+    mPrefixEntries.Clear();
 
     while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
     {
-        if (aAddress.MatchesPrefix(prefixTlv->GetPrefix(), prefixTlv->GetPrefixLength()))
+        PrefixEntry           *entry = mPrefixEntries.PushBack();
+        TlvIterator            subTlvIterator(*prefixTlv);
+        const BorderRouterTlv *brTlv;
+
+        // `kMaxPrefixEntries` covers the largest number of Prefix
+        // TLVs which can fit in Network Data.
+        OT_ASSERT(entry != nullptr);
+
+        entry->mOffset = static_cast<uint8_t>(reinterpret_cast<const uint8_t *>(prefixTlv) - mTlvBuffer);
+        entry->mFlags  = 0;
+
+        while ((brTlv = subTlvIterator.Iterate<BorderRouterTlv>()) != nullptr)
+        {
+            entry->mFlags |= PrefixEntry::kHasBorderRouter;
+
+            for (const BorderRouterEntry *brEntry = brTlv->GetFirstEntry(); brEntry <= brTlv->GetLastEntry();
+                 brEntry                          = brEntry->GetNext())
+            {
+                if (brEntry->IsOnMesh())
+                {
+                    entry->mFlags |= PrefixEntry::kHasOnMesh;
+                }
+
+                if (brEntry->IsDefaultRoute())
+                {
+                    entry->mFlags |= PrefixEntry::kHasDefaultRoute;
+                }
+            }
+        }
+
+        if (prefixTlv->FindSubTlv<HasRouteTlv>() != nullptr)
         {
-            break;
+            entry->mFlags |= PrefixEntry::kHasRoute;
         }
-    }
 
-    return prefixTlv;
+        if (prefixTlv->FindSubTlv<ContextTlv>() != nullptr)
+        {
+            entry->mFlags |= PrefixEntry::kHasContext;
+        }
+    }
 }
 
 Error LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aContext) const
 {
-    const PrefixTlv  *prefixTlv = nullptr;
-    const ContextTlv *contextTlv;
+    const PrefixEntry *entry = nullptr;
 
     aContext.mPrefix.SetLength(0);
 
@@ -147,18 +209,14 @@ Error LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aCon
         GetContextForMeshLocalPrefix(aContext);
     }
 
-    while ((prefixTlv = FindNextMatchingPrefixTlv(aAddress, prefixTlv)) != nullptr)
+    while ((entry = FindNextMatchingPrefix(aAddress, entry, PrefixEntry::kHasContext)) != nullptr)
     {
-        contextTlv = prefixTlv->FindSubTlv<ContextTlv>();
-
-        if (contextTlv == nullptr)
-        {
-            continue;
-        }
+        const PrefixTlv  &prefixTlv  = GetPrefixTlv(*entry);
+        const ContextTlv *contextTlv = prefixTlv.FindSubTlv<ContextTlv>();
 
-        if (prefixTlv->GetPrefixLength() > aContext.mPrefix.GetLength())
+        if (prefixTlv.GetPrefixLength() > aContext.mPrefix.GetLength())
         {
-            prefixTlv->CopyPrefixTo(aContext.mPrefix);
+            prefixTlv.CopyPrefixTo(aContext.mPrefix);
             aContext.mContextId    = contextTlv->GetContextId();
             aContext.mCompressFlag = contextTlv->IsCompress();
             aContext.mIsValid      = true;
@@ -170,9 +228,7 @@ Error LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aCon
 
 Error LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext) const
 {
-    Error            error = kErrorNotFound;
-    TlvIterator      tlvIterator(GetTlvsStart(), GetTlvsEnd());
-    const PrefixTlv *prefixTlv;
+    Error error = kErrorNotFound;
 
     if (aContextId == Mle::kMeshLocalPrefixContextId)
     {
@@ -180,11 +236,20 @@ Error LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext) cons
         ExitNow(error = kErrorNone);
     }
 
-    while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+    for (const PrefixEntry &entry : mPrefixEntries)
     {
-        const ContextTlv *contextTlv = prefixTlv->FindSubTlv<ContextTlv>();
+        const PrefixTlv  *prefixTlv;
+        const ContextTlv *contextTlv;
 
-        if ((contextTlv == nullptr) || (contextTlv->GetContextId() != aContextId))
+        if (!entry.HasFlags(PrefixEntry::kHasContext))
+        {
+            continue;
+        }
+
+        prefixTlv  = &GetPrefixTlv(entry);
+        contextTlv = prefixTlv->FindSubTlv<ContextTlv>();
+
+        if (contextTlv->GetContextId() != aContextId)
         {
             continue;
         }
@@ -210,51 +275,25 @@ void LeaderBase::GetContextForMeshLocalPrefix(Lowpan::Context &aContext) const
 
 bool LeaderBase::IsOnMesh(const Ip6::Address &aAddress) const
 {
-    const PrefixTlv *prefixTlv = nullptr;
-    bool             isOnMesh  = false;
-
-    VerifyOrExit(!Get<Mle::MleRouter>().IsMeshLocalAddress(aAddress), isOnMesh = true);
-
-    while ((prefixTlv = FindNextMatchingPrefixTlv(aAddress, prefixTlv)) != nullptr)
-    {
-        TlvIterator            subTlvIterator(*prefixTlv);
-        const BorderRouterTlv *brTlv;
-
-        while ((brTlv = subTlvIterator.Iterate<BorderRouterTlv>()) != nullptr)
-        {
-            for (const BorderRouterEntry *entry = brTlv->GetFirstEntry(); entry <= brTlv->GetLastEntry();
-                 entry                          = entry->GetNext())
-            {
-                if (entry->IsOnMesh())
-                {
-                    ExitNow(isOnMesh = true);
-                }
-            }
-        }
-    }
-
-exit:
-    return isOnMesh;
+    return Get<Mle::MleRouter>().IsMeshLocalAddress(aAddress) ||
+           (FindNextMatchingPrefix(aAddress, nullptr, PrefixEntry::kHasOnMesh) != nullptr);
 }
 
 Error LeaderBase::RouteLookup(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t &aRloc16) const
 {
-    Error            error     = kErrorNoRoute;
-    const PrefixTlv *prefixTlv = nullptr;
+    Error              error = kErrorNoRoute;
+    const PrefixEntry *entry = nullptr;
 
-    while ((prefixTlv = FindNextMatchingPrefixTlv(aSource, prefixTlv)) != nullptr)
+    while ((entry = FindNextMatchingPrefix(aSource, entry, PrefixEntry::kHasBorderRouter)) != nullptr)
     {
-        if (prefixTlv->FindSubTlv<BorderRouterTlv>() == nullptr)
-        {
-            continue;
-        }
+        const PrefixTlv &prefixTlv = GetPrefixTlv(*entry);
 
-        if (ExternalRouteLookup(prefixTlv->GetDomainId(), aDestination, aRloc16) == kErrorNone)
+        if (ExternalRouteLookup(prefixTlv.GetDomainId(), aDestination, aRloc16) == kErrorNone)
         {
             ExitNow(error = kErrorNone);
         }
 
-        if (DefaultRouteLookup(*prefixTlv, aRloc16) == kErrorNone)
+        if (entry->HasFlags(PrefixEntry::kHasDefaultRoute) && (DefaultRouteLookup(prefixTlv, aRloc16) == kErrorNone))
         {
             ExitNow(error = kErrorNone);
         }
@@ -315,17 +354,18 @@ exit:
 Error LeaderBase::ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDestination, uint16_t &aRloc16) const
 {
     Error                error           = kErrorNoRoute;
-    const PrefixTlv     *prefixTlv       = nullptr;
+    const PrefixEntry   *prefixEntry     = nullptr;
     const HasRouteEntry *bestRouteEntry  = nullptr;
     uint8_t              bestMatchLength = 0;
 
-    while ((prefixTlv = FindNextMatchingPrefixTlv(aDestination, prefixTlv)) != nullptr)
+    while ((prefixEntry = FindNextMatchingPrefix(aDestination, prefixEntry, PrefixEntry::kHasRoute)) != nullptr)
     {
+        const PrefixTlv   &prefixTlv = GetPrefixTlv(*prefixEntry);
         const HasRouteTlv *hasRoute;
-        uint8_t            prefixLength = prefixTlv->GetPrefixLength();
-        TlvIterator        subTlvIterator(*prefixTlv);
+        uint8_t            prefixLength = prefixTlv.GetPrefixLength();
+        TlvIterator        subTlvIterator(prefixTlv);
 
-        if (prefixTlv->GetDomainId() != aDomainId)
+        if (prefixTlv.GetDomainId() != aDomainId)
         {
             continue;
         }
@@ -450,6 +490,13 @@ Error LeaderBase::SetCommissioningData(const uint8_t *aValue, uint8_t aValueLeng
     SignalNetDataChanged();
 
 exit:
+    if (error != kErrorNone)
+    {
+        // Removing the previous Commissioning Data TLV may have moved
+        // the Prefix TLVs, so the prefix entries need to be updated.
+        UpdatePrefixEntries();
+    }
+
     return error;
 }
 
@@ -545,6 +592,7 @@ Error LeaderBase::SteeringDataCheckJoiner(const MeshCoP::JoinerDiscerner &aDisce
 void LeaderBase::SignalNetDataChanged(void)
 {
     mMaxLength = Max(mMaxLength, GetLength());
+    UpdatePrefixEntries();
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 }
 
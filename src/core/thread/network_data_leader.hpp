@@ -39,6 +39,7 @@
 #include <stdint.h>
 
 #include "coap/coap.hpp"
+#include "common/array.hpp"
 #include "common/const_cast.hpp"
 #include "common/timer.hpp"
 #include "net/ip6_address.hpp"
@@ -299,6 +300,7 @@ public:
 
 protected:
     void SignalNetDataChanged(void);
+    void UpdatePrefixEntries(void);
 
     uint8_t mStableVersion;
     uint8_t mVersion;
@@ -306,7 +308,34 @@ protected:
 private:
     using FilterIndexes = MeshCoP::SteeringData::HashBitIndexes;
 
-    const PrefixTlv *FindNextMatchingPrefixTlv(const Ip6::Address &aAddress, const PrefixTlv *aPrevTlv) const;
+    // `mPrefixEntries` is a compact table of the Prefix TLVs in the
+    // Network Data (in TLV order) which is rebuilt by
+    // `UpdatePrefixEntries()` whenever the Network Data changes. Each
+    // entry records the offset of a Prefix TLV in `mTlvBuffer` along
+    // with flags summarizing its sub-TLVs, so that per-packet route,
+    // context and on-mesh lookups only match against and parse the
+    // Prefix TLVs which can contribute to the result.
+
+    static constexpr uint8_t kMaxPrefixEntries = kMaxSize / sizeof(PrefixTlv);
+
+    struct PrefixEntry
+    {
+        static constexpr uint8_t kHasBorderRouter = 1 << 0; // Contains a Border Router sub-TLV.
+        static constexpr uint8_t kHasOnMesh       = 1 << 1; // Contains a Border Router entry with on-mesh flag.
+        static constexpr uint8_t kHasDefaultRoute = 1 << 2; // Contains a Border Router entry with default route flag.
+        static constexpr uint8_t kHasRoute        = 1 << 3; // Contains a Has Route sub-TLV.
+        static constexpr uint8_t kHasContext      = 1 << 4; // Contains a Context sub-TLV.
+
+        bool HasFlags(uint8_t aFlags) const { return (mFlags & aFlags) == aFlags; }
+
+        uint8_t mOffset;
+        uint8_t mFlags;
+    };
+
+    const PrefixTlv   &GetPrefixTlv(const PrefixEntry &aEntry) const;
+    const PrefixEntry *FindNextMatchingPrefix(const Ip6::Address &aAddress,
+                                              const PrefixEntry  *aPrevEntry,
+                                              uint8_t             aFlags) const;
 
     void RemoveCommissioningData(void);
 
@@ -321,8 +350,9 @@ private:
     Error SteeringDataCheck(const FilterIndexes &aFilterIndexes) const;
     void  GetContextForMeshLocalPrefix(Lowpan::Context &aContext) const;
 
-    uint8_t mTlvBuffer[kMaxSize];
-    uint8_t mMaxLength;
+    uint8_t                               mTlvBuffer[kMaxSize];
+    uint8_t                               mMaxLength;
+    Array<PrefixEntry, kMaxPrefixEntries> mPrefixEntries;
 };
 
 /**
@@ -113,12 +113,19 @@ void Leader::IncrementVersions(const ChangedFlags &aFlags)
     {
         IncrementVersions(aFlags.DidStableChange());
     }
+    else
+    {
+        // Content is unchanged but TLVs may have been moved (e.g.,
+        // an empty Prefix TLV removed), so the prefix entries need
+        // to be updated.
+        UpdatePrefixEntries();
+    }
 }
 
 void Leader::IncrementVersions(bool aIncludeStable)
 {
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_SIGNAL_NETWORK_DATA_FULL
-    VerifyOrExit(!mIsClone);
+    VerifyOrExit(!mIsClone, UpdatePrefixEntries());
 #endif
 
     if (aIncludeStable)
@@ -210,21 +210,87 @@ exit:
 
 Error SourceMatchController::AddPendingEntries(void)
 {
-    Error error = kErrorNone;
+    Error error;
+
+    SuccessOrExit(error = AddPendingEntries(/* aUseShortAddress */ true));
+    error = AddPendingEntries(/* aUseShortAddress */ false);
+
+exit:
+    return error;
+}
+
+Error SourceMatchController::AddPendingEntries(bool aUseShortAddress)
+{
+    Error    error = kErrorNone;
+    Child   *children[kMaxBatchSize];
+    uint16_t numChildren = 0;
 
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValidOrRestoring))
     {
-        if (child.IsIndirectSourceMatchPending())
+        if (!child.IsIndirectSourceMatchPending() || (child.IsIndirectSourceMatchShort() != aUseShortAddress))
+        {
+            continue;
+        }
+
+        children[numChildren++] = &child;
+
+        if (numChildren == kMaxBatchSize)
         {
-            SuccessOrExit(error = AddAddress(child));
-            child.SetIndirectSourceMatchPending(false);
+            SuccessOrExit(error = AddAddresses(children, numChildren, aUseShortAddress));
+            numChildren = 0;
         }
     }
 
+    if (numChildren > 0)
+    {
+        error = AddAddresses(children, numChildren, aUseShortAddress);
+    }
+
 exit:
     return error;
 }
 
+Error SourceMatchController::AddAddresses(Child *const aChildren[], uint16_t aNumChildren, bool aUseShortAddress)
+{
+    Error    error;
+    uint16_t numAdded = 0;
+
+    OT_ASSERT(aNumChildren <= kMaxBatchSize);
+
+    if (aUseShortAddress)
+    {
+        Mac::ShortAddress addresses[kMaxBatchSize];
+
+        for (uint16_t i = 0; i < aNumChildren; i++)
+        {
+            addresses[i] = aChildren[i]->GetRloc16();
+        }
+
+        error = Get<Radio>().AddSrcMatchShortEntries(addresses, aNumChildren, numAdded);
+    }
+    else
+    {
+        Mac::ExtAddress addresses[kMaxBatchSize];
+
+        for (uint16_t i = 0; i < aNumChildren; i++)
+        {
+            addresses[i].Set(aChildren[i]->GetExtAddress().m8, Mac::ExtAddress::kReverseByteOrder);
+        }
+
+        error = Get<Radio>().AddSrcMatchExtEntries(addresses, aNumChildren, numAdded);
+    }
+
+    LogDebg("Adding %u %s addrs -- %u added, %s (%d)", aNumChildren, aUseShortAddress ? "short" : "ext", numAdded,
+            ErrorToString(error), error);
+
+    for (uint16_t i = 0; i < numAdded; i++)
+    {
+        aChildren[i]->SetIndirectSourceMatchPending(false);
+    }
+
+    return error;
+}
+
 } // namespace ot
 
 #endif // OPENTHREAD_FTD
@@ -186,6 +186,33 @@ private:
      */
     Error AddPendingEntries(void);
 
+    /**
+     * Adds pending entries of one address type to the source match table, a batch of entries at a time.
+     *
+     * @param[in] aUseShortAddress  `true` to add the children using short address, `false` for extended address.
+     *
+     * @retval kErrorNone     All pending entries of the given type were successfully added.
+     * @retval kErrorNoBufs   No available space in the source match table.
+     *
+     */
+    Error AddPendingEntries(bool aUseShortAddress);
+
+    /**
+     * Adds the addresses of a batch of children to the source match table, clearing the pending flag of the children
+     * whose address was added.
+     *
+     * @param[in] aChildren         An array of pointers to the children.
+     * @param[in] aNumChildren      The number of children in @p aChildren (at most `kMaxBatchSize`).
+     * @param[in] aUseShortAddress  `true` to add the short addresses, `false` to add the extended addresses.
+     *
+     * @retval kErrorNone     All addresses were successfully added.
+     * @retval kErrorNoBufs   No available space in the source match table.
+     *
+     */
+    Error AddAddresses(Child *const aChildren[], uint16_t aNumChildren, bool aUseShortAddress);
+
+    static constexpr uint16_t kMaxBatchSize = 16; // Max number of entries passed to the radio at once.
+
     bool mEnabled;
 };
 
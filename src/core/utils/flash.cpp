@@ -46,6 +46,8 @@ void Flash::Init(void)
 {
     RecordHeader record;
 
+    InvalidateOffsetCache();
+
     otPlatFlashInit(&GetInstance());
 
     mSwapSize = otPlatFlashGetSwapSize(&GetInstance());
@@ -118,11 +120,69 @@ Error Flash::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLen
 {
     Error        error       = kErrorNotFound;
     uint16_t     valueLength = 0;
-    int          index       = 0; // This must be initialized to 0. See [Note] in Delete().
     uint32_t     offset;
     RecordHeader record;
 
-    for (offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
+    VerifyOrExit(aIndex >= 0);
+
+    if (!IsIndexCached(aKey, aIndex))
+    {
+        AsNonConst(this)->UpdateOffsetCache(aKey, aIndex);
+    }
+
+    offset = mCachedOffsets[aIndex - mCacheBaseIndex];
+    VerifyOrExit(offset != kInvalidOffset);
+
+    otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
+
+    if (aValue && aValueLength)
+    {
+        uint16_t readLength = *aValueLength;
+
+        if (readLength > record.GetLength())
+        {
+            readLength = record.GetLength();
+        }
+
+        otPlatFlashRead(&GetInstance(), mSwapIndex, offset + sizeof(record), aValue, readLength);
+    }
+
+    valueLength = record.GetLength();
+    error       = kErrorNone;
+
+exit:
+    if (aValueLength)
+    {
+        *aValueLength = valueLength;
+    }
+
+    return error;
+}
+
+bool Flash::IsIndexCached(uint16_t aKey, int aIndex) const
+{
+    return mIsOffsetCacheValid && (mCacheKey == aKey) && (aIndex >= mCacheBaseIndex) &&
+           (aIndex - mCacheBaseIndex < kOffsetCacheSize);
+}
+
+void Flash::UpdateOffsetCache(uint16_t aKey, int aIndex)
+{
+    int          index = 0; // This must be initialized to 0. See [Note] in Delete().
+    RecordHeader record;
+
+    mIsOffsetCacheValid = true;
+    mCacheKey           = aKey;
+    mCacheBaseIndex     = aIndex;
+
+    for (uint32_t &cachedOffset : mCachedOffsets)
+    {
+        cachedOffset = kInvalidOffset;
+    }
+
+    // The last record found at a given index is the one `Get()`
+    // returns, so later records overwrite earlier cached offsets.
+
+    for (uint32_t offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
     {
         otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
 
@@ -136,33 +196,13 @@ Error Flash::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLen
             index = 0;
         }
 
-        if (index == aIndex)
+        if ((index >= mCacheBaseIndex) && (index - mCacheBaseIndex < kOffsetCacheSize))
         {
-            if (aValue && aValueLength)
-            {
-                uint16_t readLength = *aValueLength;
-
-                if (readLength > record.GetLength())
-                {
-                    readLength = record.GetLength();
-                }
-
-                otPlatFlashRead(&GetInstance(), mSwapIndex, offset + sizeof(record), aValue, readLength);
-            }
-
-            valueLength = record.GetLength();
-            error       = kErrorNone;
+            mCachedOffsets[index - mCacheBaseIndex] = offset;
         }
 
         index++;
     }
-
-    if (aValueLength)
-    {
-        *aValueLength = valueLength;
-    }
-
-    return error;
 }
 
 Error Flash::Set(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
@@ -182,6 +222,8 @@ Error Flash::Add(uint16_t aKey, bool aFirst, const uint8_t *aValue, uint16_t aVa
     Error  error = kErrorNone;
     Record record;
 
+    InvalidateOffsetCache();
+
     record.Init(aKey, aFirst);
     record.SetData(aValue, aValueLength);
 
@@ -229,6 +271,8 @@ void Flash::Swap(void)
     uint32_t dstOffset = kSwapMarkerSize;
     Record   record;
 
+    InvalidateOffsetCache();
+
     otPlatFlashErase(&GetInstance(), dstIndex);
 
     for (uint32_t srcOffset = kSwapMarkerSize; srcOffset < mSwapUsed; srcOffset += record.GetSize())
@@ -261,6 +305,8 @@ Error Flash::Delete(uint16_t aKey, int aIndex)
     int          index = 0; // This must be initialized to 0. See [Note] below.
     RecordHeader record;
 
+    InvalidateOffsetCache();
+
     for (uint32_t offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
     {
         otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
@@ -300,6 +346,8 @@ Error Flash::Delete(uint16_t aKey, int aIndex)
 
 void Flash::Wipe(void)
 {
+    InvalidateOffsetCache();
+
     otPlatFlashErase(&GetInstance(), 0);
     otPlatFlashWrite(&GetInstance(), 0, 0, &sSwapActive, sizeof(sSwapActive));
 
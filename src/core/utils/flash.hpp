@@ -38,6 +38,7 @@
 
 #include <openthread/platform/toolchain.h>
 
+#include "common/const_cast.hpp"
 #include "common/debug.hpp"
 #include "common/error.hpp"
 #include "common/locator.hpp"
@@ -137,7 +138,9 @@ public:
     void Wipe(void);
 
 private:
-    static constexpr uint32_t kSwapMarkerSize = 4; // in bytes
+    static constexpr uint32_t kSwapMarkerSize  = 4;  // in bytes
+    static constexpr uint32_t kInvalidOffset   = 0;  // Offset zero is the swap marker, never a record.
+    static constexpr uint16_t kOffsetCacheSize = 16; // Number of consecutive indexes in the offset cache.
 
     static const uint32_t sSwapActive   = 0xbe5cc5ee;
     static const uint32_t sSwapInactive = 0xbe5cc5ec;
@@ -217,10 +220,23 @@ private:
     bool  DoesValidRecordExist(uint32_t aOffset, uint16_t aKey) const;
     void  SanitizeFreeSpace(void);
     void  Swap(void);
+    bool  IsIndexCached(uint16_t aKey, int aIndex) const;
+    void  UpdateOffsetCache(uint16_t aKey, int aIndex);
+    void  InvalidateOffsetCache(void) { mIsOffsetCacheValid = false; }
 
     uint32_t mSwapSize;
     uint32_t mSwapUsed;
     uint8_t  mSwapIndex;
+
+    // Record offsets of `kOffsetCacheSize` consecutive indexes of
+    // one key, starting from `mCacheBaseIndex`, filled by a single
+    // scan. This lets `Get()` iterate over the values of a key
+    // (e.g. child info) without rescanning the swap area for every
+    // index. It is invalidated on any change to the swap area.
+    bool     mIsOffsetCacheValid;
+    uint16_t mCacheKey;
+    int      mCacheBaseIndex;
+    uint32_t mCachedOffsets[kOffsetCacheSize];
 };
 
 } // namespace ot
@@ -50,6 +50,18 @@ namespace Hdlc {
  */
 static uint16_t UpdateFcs(uint16_t aFcs, uint8_t aByte);
 
+/**
+ * Updates an FCS with a sequence of bytes.
+ *
+ * @param[in]  aFcs     The FCS to update.
+ * @param[in]  aData    A pointer to the input bytes.
+ * @param[in]  aLength  Number of input bytes.
+ *
+ * @returns The updated FCS.
+ *
+ */
+static uint16_t UpdateFcs(uint16_t aFcs, const uint8_t *aData, uint16_t aLength);
+
 enum
 {
     kFlagXOn        = 0x11,
@@ -95,6 +107,16 @@ uint16_t UpdateFcs(uint16_t aFcs, uint8_t aByte)
     return (aFcs >> 8) ^ sFcsTable[(aFcs ^ aByte) & 0xff];
 }
 
+uint16_t UpdateFcs(uint16_t aFcs, const uint8_t *aData, uint16_t aLength)
+{
+    while (aLength--)
+    {
+        aFcs = UpdateFcs(aFcs, *aData++);
+    }
+
+    return aFcs;
+}
+
 static bool HdlcByteNeedsEscape(uint8_t aByte)
 {
     bool rval;
@@ -117,6 +139,36 @@ static bool HdlcByteNeedsEscape(uint8_t aByte)
     return rval;
 }
 
+static uint16_t GetUnescapedRunLength(const uint8_t *aData, uint16_t aLength)
+{
+    // Returns the number of leading bytes in `aData` which can be
+    // sent as is (without escaping).
+
+    uint16_t length = 0;
+
+    while ((length < aLength) && !HdlcByteNeedsEscape(aData[length]))
+    {
+        length++;
+    }
+
+    return length;
+}
+
+static uint16_t GetPlainRunLength(const uint8_t *aData, uint16_t aLength)
+{
+    // Returns the number of leading bytes in received `aData` which
+    // are neither a flag nor an escape sequence.
+
+    uint16_t length = 0;
+
+    while ((length < aLength) && (aData[length] != kFlagSequence) && (aData[length] != kEscapeSequence))
+    {
+        length++;
+    }
+
+    return length;
+}
+
 Encoder::Encoder(Spinel::FrameWritePointer &aWritePointer)
     : mWritePointer(aWritePointer)
     , mFcs(0)
@@ -158,9 +210,23 @@ otError Encoder::Encode(const uint8_t *aData, uint16_t aLength)
     uint16_t                  oldFcs     = mFcs;
     Spinel::FrameWritePointer oldPointer = mWritePointer;
 
-    while (aLength--)
+    while (aLength > 0)
     {
-        SuccessOrExit(error = Encode(*aData++));
+        uint16_t runLength = GetUnescapedRunLength(aData, aLength);
+
+        if (runLength == 0)
+        {
+            SuccessOrExit(error = Encode(*aData));
+            runLength = 1;
+        }
+        else
+        {
+            SuccessOrExit(error = mWritePointer.WriteData(aData, runLength));
+            mFcs = UpdateFcs(mFcs, aData, runLength);
+        }
+
+        aData += runLength;
+        aLength -= runLength;
     }
 
 exit:
@@ -266,11 +332,26 @@ void Decoder::Decode(const uint8_t *aData, uint16_t aLength)
                 break;
 
             default:
-                if (mWritePointer.CanWrite(sizeof(uint8_t)))
+            {
+                // Decode the run of bytes up to the next flag or
+                // escape sequence in one go, limited to the space
+                // left in the frame buffer.
+
+                const uint8_t *run       = aData - 1;
+                uint16_t       runLength = 1 + GetPlainRunLength(aData, aLength);
+
+                if (runLength > mWritePointer.GetRemainingLength())
                 {
-                    mFcs = UpdateFcs(mFcs, byte);
-                    IgnoreError(mWritePointer.WriteByte(byte));
-                    mDecodedLength++;
+                    runLength = mWritePointer.GetRemainingLength();
+                }
+
+                if (runLength > 0)
+                {
+                    mFcs = UpdateFcs(mFcs, run, runLength);
+                    IgnoreError(mWritePointer.WriteData(run, runLength));
+                    mDecodedLength += runLength;
+                    aData += runLength - 1;
+                    aLength -= runLength - 1;
                 }
                 else
                 {
@@ -280,6 +361,7 @@ void Decoder::Decode(const uint8_t *aData, uint16_t aLength)
 
                 break;
             }
+            }
 
             break;
 
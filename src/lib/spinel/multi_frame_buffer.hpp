@@ -90,6 +90,39 @@ public:
                                          : OT_ERROR_NO_BUFS;
     }
 
+    /**
+     * Writes a block of bytes into the buffer and updates the write pointer (if space is available).
+     *
+     * @param[in]  aData    A pointer to the bytes to be written to the buffer.
+     * @param[in]  aLength  Number of bytes to write.
+     *
+     * @retval OT_ERROR_NONE     Successfully wrote the bytes and updated the pointer.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffer space to write the bytes. Nothing is written.
+     *
+     */
+    otError WriteData(const uint8_t *aData, uint16_t aLength)
+    {
+        otError error = OT_ERROR_NO_BUFS;
+
+        if (CanWrite(aLength))
+        {
+            memcpy(mWritePointer, aData, aLength);
+            mWritePointer += aLength;
+            mRemainingLength -= aLength;
+            error = OT_ERROR_NONE;
+        }
+
+        return error;
+    }
+
+    /**
+     * Returns the number of bytes that can still be written into the buffer.
+     *
+     * @returns The remaining buffer space in bytes.
+     *
+     */
+    uint16_t GetRemainingLength(void) const { return mRemainingLength; }
+
     /**
      * Undoes the last @p aUndoLength writes, removing them from frame.
      *
@@ -388,6 +388,23 @@ public:
      */
     otError AddSrcMatchShortEntry(uint16_t aShortAddress);
 
+    /**
+     * Adds a number of short addresses to the source address match table.
+     *
+     * The entries are sent back to back as pipelined requests. On failure, the first @p aNumAdded entries were added
+     * and the remaining ones were not.
+     *
+     * @param[in]  aShortAddresses  A pointer to an array of short addresses to be added.
+     * @param[in]  aNumEntries      The number of entries in @p aShortAddresses.
+     * @param[out] aNumAdded        A reference to output the number of entries that were added.
+     *
+     * @retval  OT_ERROR_NONE               Successfully added all short addresses to the source match table.
+     * @retval  OT_ERROR_BUSY               Failed due to another operation is on going.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     * @retval  OT_ERROR_NO_BUFS            No available entry in the source match table.
+     */
+    otError AddSrcMatchShortEntries(const uint16_t *aShortAddresses, uint16_t aNumEntries, uint16_t &aNumAdded);
+
     /**
      * Removes a short address from the source address match table.
      *
@@ -426,6 +443,24 @@ public:
      */
     otError AddSrcMatchExtEntry(const otExtAddress &aExtAddress);
 
+    /**
+     * Adds a number of extended addresses to the source address match table.
+     *
+     * The entries are sent back to back as pipelined requests. On failure, the first @p aNumAdded entries were added
+     * and the remaining ones were not.
+     *
+     * @param[in]  aExtAddresses  A pointer to an array of extended addresses to be added stored in little-endian byte
+     *                            order.
+     * @param[in]  aNumEntries    The number of entries in @p aExtAddresses.
+     * @param[out] aNumAdded      A reference to output the number of entries that were added.
+     *
+     * @retval  OT_ERROR_NONE               Successfully added all extended addresses to the source match table.
+     * @retval  OT_ERROR_BUSY               Failed due to another operation is on going.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     * @retval  OT_ERROR_NO_BUFS            No available entry in the source match table.
+     */
+    otError AddSrcMatchExtEntries(const otExtAddress *aExtAddresses, uint16_t aNumEntries, uint16_t &aNumAdded);
+
     /**
      * Remove an extended address from the source address match table.
      *
@@ -932,6 +967,8 @@ private:
         kVersionStringSize     = 128,  ///< Max size of version string.
         kCapsBufferSize        = 100,  ///< Max buffer size used to store `SPINEL_PROP_CAPS` value.
         kChannelMaskBufferSize = 32,   ///< Max buffer size used to store `SPINEL_PROP_PHY_CHAN_SUPPORTED` value.
+        kMaxPipelinedRequests  = 8,    ///< Max number of pipelined requests outstanding at a time.
+        kNumTids               = SPINEL_HEADER_TID_MASK + 1, ///< Number of spinel transaction ids.
     };
 
     enum State
@@ -985,6 +1022,43 @@ private:
                                         const char       *aFormat,
                                         va_list           aArgs);
     otError WaitResponse(bool aHandleRcpTimeout = true);
+
+    /**
+     * Sends a spinel command without waiting for its response.
+     *
+     * Up to `kMaxPipelinedRequests` such commands may be outstanding at a time, sent back to back. Their responses
+     * are matched by transaction id as they arrive and the first failure is reported by `WaitPipelinedResponses()`.
+     * If the pipeline is full, waits for the outstanding responses first.
+     *
+     * @param[in] aExpectedCommand  The command expected in a successful response.
+     * @param[in] aCommand          The spinel command to send.
+     * @param[in] aKey              The spinel property key.
+     * @param[in] aFormat           The spinel format string of the command payload.
+     *
+     * @retval  OT_ERROR_NONE              Successfully sent the command.
+     * @retval  OT_ERROR_BUSY              Failed due to no transaction id being available.
+     * @retval  OT_ERROR_NO_BUFS           Failed due to no buffer space.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT  Failed due to no response received for an earlier pipelined command.
+     *
+     */
+    otError SendPipelined(uint32_t          aExpectedCommand,
+                          uint32_t          aCommand,
+                          spinel_prop_key_t aKey,
+                          const char       *aFormat,
+                          ...);
+
+    /**
+     * Waits for the responses to all outstanding pipelined commands.
+     *
+     * @param[out] aSucceeded  A pointer to output a bit mask of the commands sent since the last call that succeeded,
+     *                         where bit `i` is set if the `i`-th command sent succeeded (can be `nullptr`).
+     *
+     * @returns The first error reported by a pipelined command since the last call, or `OT_ERROR_RESPONSE_TIMEOUT`.
+     *
+     */
+    otError WaitPipelinedResponses(uint16_t *aSucceeded = nullptr);
+
+    static uint16_t CountLeadingSucceeded(uint16_t aSucceeded);
     otError SendCommand(uint32_t          aCommand,
                         spinel_prop_key_t aKey,
                         spinel_tid_t      aTid,
@@ -1015,6 +1089,11 @@ private:
     void HandleResponse(const uint8_t *aBuffer, uint16_t aLength);
     void HandleTransmitDone(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
     void HandleWaitingResponse(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
+    void HandlePipelinedResponse(spinel_tid_t      aTid,
+                                 uint32_t          aCommand,
+                                 spinel_prop_key_t aKey,
+                                 const uint8_t    *aBuffer,
+                                 uint16_t          aLength);
 
     void RadioReceive(void);
 
@@ -1034,6 +1113,11 @@ private:
         mRadioSpinelMetrics.mSpinelParseErrorCount += (aError == OT_ERROR_PARSE) ? 1 : 0;
     }
 
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    void RecordSrcMatchShortEntry(uint16_t aShortAddress);
+    void RecordSrcMatchExtEntry(const otExtAddress &aExtAddress);
+#endif
+
     uint32_t Snprintf(char *aDest, uint32_t aSize, const char *aFormat, ...);
     void     LogSpinelFrame(const uint8_t *aFrame, uint16_t aLength, bool aTx);
 
@@ -1053,6 +1137,20 @@ private:
     uint32_t          mExpectedCommand; ///< Expected response command of current transaction.
     otError           mError;           ///< The result of current transaction.
 
+    struct PipelinedRequest
+    {
+        spinel_prop_key_t mKey;             ///< The property key of the pipelined transaction.
+        uint32_t          mExpectedCommand; ///< Expected response command of the pipelined transaction.
+        uint8_t           mIndex;           ///< The send order of the pipelined transaction since the last wait.
+    };
+
+    uint16_t         mPipelinedTids;               ///< Transaction ids of outstanding pipelined requests.
+    uint8_t          mPipelinedRequestCount;       ///< Number of outstanding pipelined requests.
+    uint8_t          mPipelinedNumSent;            ///< Number of pipelined requests sent since the last wait.
+    otError          mPipelinedError;              ///< The first error of pipelined requests.
+    uint16_t         mPipelinedSucceeded;          ///< Bit mask of succeeded pipelined requests, in send order.
+    PipelinedRequest mPipelinedRequests[kNumTids]; ///< Pipelined requests, indexed by transaction id.
+
     uint8_t       mRxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t       mTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t       mAckPsdu[OT_RADIO_FRAME_MAX_SIZE];
@@ -176,6 +176,11 @@ RadioSpinel<InterfaceType>::RadioSpinel(void)
     , mPropertyFormat(nullptr)
     , mExpectedCommand(0)
     , mError(OT_ERROR_NONE)
+    , mPipelinedTids(0)
+    , mPipelinedRequestCount(0)
+    , mPipelinedNumSent(0)
+    , mPipelinedError(OT_ERROR_NONE)
+    , mPipelinedSucceeded(0)
     , mTransmitFrame(nullptr)
     , mShortAddress(0)
     , mPanId(0xffff)
@@ -601,6 +606,10 @@ void RadioSpinel<InterfaceType>::HandleResponse(const uint8_t *aBuffer, uint16_t
         FreeTid(mTxRadioTid);
         mTxRadioTid = 0;
     }
+    else if ((mPipelinedTids & (1 << SPINEL_HEADER_GET_TID(header))) != 0)
+    {
+        HandlePipelinedResponse(SPINEL_HEADER_GET_TID(header), cmd, key, data, static_cast<uint16_t>(len));
+    }
     else
     {
         otLogWarnPlat("Unexpected Spinel transaction message: %u", SPINEL_HEADER_GET_TID(header));
@@ -681,6 +690,47 @@ exit:
     LogIfFail("Error processing result", mError);
 }
 
+template <typename InterfaceType>
+void RadioSpinel<InterfaceType>::HandlePipelinedResponse(spinel_tid_t      aTid,
+                                                         uint32_t          aCommand,
+                                                         spinel_prop_key_t aKey,
+                                                         const uint8_t    *aBuffer,
+                                                         uint16_t          aLength)
+{
+    const PipelinedRequest &request = mPipelinedRequests[aTid];
+    otError                 error   = OT_ERROR_NONE;
+
+    if (aKey == SPINEL_PROP_LAST_STATUS)
+    {
+        spinel_status_t status;
+        spinel_ssize_t  unpacked = spinel_datatype_unpack(aBuffer, aLength, "i", &status);
+
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+        error = SpinelStatusToOtError(status);
+    }
+    else if (aKey != request.mKey || aCommand != request.mExpectedCommand)
+    {
+        error = OT_ERROR_DROP;
+    }
+
+exit:
+    FreeTid(aTid);
+    mPipelinedTids &= ~(1 << aTid);
+    --mPipelinedRequestCount;
+
+    if (error == OT_ERROR_NONE)
+    {
+        mPipelinedSucceeded |= (1 << request.mIndex);
+    }
+    else if (mPipelinedError == OT_ERROR_NONE)
+    {
+        mPipelinedError = error;
+    }
+
+    UpdateParseErrorCount(error);
+    LogIfFail("Error processing pipelined result", error);
+}
+
 template <typename InterfaceType>
 void RadioSpinel<InterfaceType>::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength)
 {
@@ -1081,20 +1131,76 @@ template <typename InterfaceType> otError RadioSpinel<InterfaceType>::AddSrcMatc
     SuccessOrExit(error = Insert(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, aShortAddress));
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
-    assert(mSrcMatchShortEntryCount < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN);
+    RecordSrcMatchShortEntry(aShortAddress);
+#endif
 
-    for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
+exit:
+    return error;
+}
+
+template <typename InterfaceType>
+otError RadioSpinel<InterfaceType>::AddSrcMatchShortEntries(const uint16_t *aShortAddresses,
+                                                            uint16_t        aNumEntries,
+                                                            uint16_t       &aNumAdded)
+{
+    otError error = OT_ERROR_NONE;
+
+    aNumAdded = 0;
+
+    while (error == OT_ERROR_NONE && aNumAdded < aNumEntries)
     {
-        if (mSrcMatchShortEntries[i] == aShortAddress)
+        uint16_t numToSend    = aNumEntries - aNumAdded;
+        uint16_t numSent      = 0;
+        uint16_t succeeded    = 0;
+        uint16_t numSucceeded = 0;
+        otError  waitError;
+
+        if (numToSend > kMaxPipelinedRequests)
         {
-            ExitNow();
+            numToSend = kMaxPipelinedRequests;
+        }
+
+        for (uint16_t i = 0; i < numToSend && error == OT_ERROR_NONE; i++)
+        {
+            error = SendPipelined(SPINEL_CMD_PROP_VALUE_INSERTED, SPINEL_CMD_PROP_VALUE_INSERT,
+                                  SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S,
+                                  aShortAddresses[aNumAdded + i]);
+            numSent += (error == OT_ERROR_NONE) ? 1 : 0;
+        }
+
+        waitError    = WaitPipelinedResponses(&succeeded);
+        numSucceeded = CountLeadingSucceeded(succeeded);
+
+        if (error == OT_ERROR_NONE)
+        {
+            error = waitError;
+        }
+
+        // The inserts behind a failed one may still have succeeded on
+        // the RCP. They are removed again so that exactly the first
+        // `aNumAdded` entries are added, as reported to the caller.
+        // After a response timeout the RCP is being recovered, and
+        // only the recorded entries are restored.
+
+        for (uint16_t i = numSucceeded + 1; (waitError != OT_ERROR_RESPONSE_TIMEOUT) && (i < numSent); i++)
+        {
+            if (succeeded & (1 << i))
+            {
+                IgnoreError(Remove(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S,
+                                   aShortAddresses[aNumAdded + i]));
+            }
+        }
+
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+        for (uint16_t i = 0; i < numSucceeded; i++)
+        {
+            RecordSrcMatchShortEntry(aShortAddresses[aNumAdded + i]);
         }
-    }
-    mSrcMatchShortEntries[mSrcMatchShortEntryCount] = aShortAddress;
-    ++mSrcMatchShortEntryCount;
 #endif
 
-exit:
+        aNumAdded += numSucceeded;
+    }
+
     return error;
 }
 
@@ -1107,20 +1213,76 @@ otError RadioSpinel<InterfaceType>::AddSrcMatchExtEntry(const otExtAddress &aExt
                       Insert(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
-    assert(mSrcMatchExtEntryCount < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN);
+    RecordSrcMatchExtEntry(aExtAddress);
+#endif
 
-    for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
+exit:
+    return error;
+}
+
+template <typename InterfaceType>
+otError RadioSpinel<InterfaceType>::AddSrcMatchExtEntries(const otExtAddress *aExtAddresses,
+                                                          uint16_t            aNumEntries,
+                                                          uint16_t           &aNumAdded)
+{
+    otError error = OT_ERROR_NONE;
+
+    aNumAdded = 0;
+
+    while (error == OT_ERROR_NONE && aNumAdded < aNumEntries)
     {
-        if (memcmp(aExtAddress.m8, mSrcMatchExtEntries[i].m8, OT_EXT_ADDRESS_SIZE) == 0)
+        uint16_t numToSend    = aNumEntries - aNumAdded;
+        uint16_t numSent      = 0;
+        uint16_t succeeded    = 0;
+        uint16_t numSucceeded = 0;
+        otError  waitError;
+
+        if (numToSend > kMaxPipelinedRequests)
         {
-            ExitNow();
+            numToSend = kMaxPipelinedRequests;
+        }
+
+        for (uint16_t i = 0; i < numToSend && error == OT_ERROR_NONE; i++)
+        {
+            error = SendPipelined(SPINEL_CMD_PROP_VALUE_INSERTED, SPINEL_CMD_PROP_VALUE_INSERT,
+                                  SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S,
+                                  aExtAddresses[aNumAdded + i].m8);
+            numSent += (error == OT_ERROR_NONE) ? 1 : 0;
+        }
+
+        waitError    = WaitPipelinedResponses(&succeeded);
+        numSucceeded = CountLeadingSucceeded(succeeded);
+
+        if (error == OT_ERROR_NONE)
+        {
+            error = waitError;
+        }
+
+        // The inserts behind a failed one may still have succeeded on
+        // the RCP. They are removed again so that exactly the first
+        // `aNumAdded` entries are added, as reported to the caller.
+        // After a response timeout the RCP is being recovered, and
+        // only the recorded entries are restored.
+
+        for (uint16_t i = numSucceeded + 1; (waitError != OT_ERROR_RESPONSE_TIMEOUT) && (i < numSent); i++)
+        {
+            if (succeeded & (1 << i))
+            {
+                IgnoreError(Remove(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S,
+                                   aExtAddresses[aNumAdded + i].m8));
+            }
+        }
+
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+        for (uint16_t i = 0; i < numSucceeded; i++)
+        {
+            RecordSrcMatchExtEntry(aExtAddresses[aNumAdded + i]);
         }
-    }
-    mSrcMatchExtEntries[mSrcMatchExtEntryCount] = aExtAddress;
-    ++mSrcMatchExtEntryCount;
 #endif
 
-exit:
+        aNumAdded += numSucceeded;
+    }
+
     return error;
 }
 
@@ -1516,6 +1678,94 @@ exit:
     return mError;
 }
 
+template <typename InterfaceType>
+otError RadioSpinel<InterfaceType>::SendPipelined(uint32_t          aExpectedCommand,
+                                                  uint32_t          aCommand,
+                                                  spinel_prop_key_t aKey,
+                                                  const char       *aFormat,
+                                                  ...)
+{
+    otError      error = OT_ERROR_NONE;
+    spinel_tid_t tid;
+    va_list      args;
+
+    assert(mWaitingTid == 0);
+
+    if (mPipelinedRequestCount >= kMaxPipelinedRequests)
+    {
+        SuccessOrExit(error = WaitPipelinedResponses());
+    }
+
+    tid = GetNextTid();
+    VerifyOrExit(tid > 0, error = OT_ERROR_BUSY);
+
+    va_start(args, aFormat);
+    error = SendCommand(aCommand, aKey, tid, aFormat, args);
+    va_end(args);
+
+    if (error != OT_ERROR_NONE)
+    {
+        FreeTid(tid);
+        ExitNow();
+    }
+
+    mPipelinedRequests[tid].mKey             = aKey;
+    mPipelinedRequests[tid].mExpectedCommand = aExpectedCommand;
+    mPipelinedRequests[tid].mIndex           = mPipelinedNumSent++;
+    mPipelinedTids |= (1 << tid);
+    ++mPipelinedRequestCount;
+
+exit:
+    return error;
+}
+
+template <typename InterfaceType> otError RadioSpinel<InterfaceType>::WaitPipelinedResponses(uint16_t *aSucceeded)
+{
+    uint64_t end = otPlatTimeGet() + kMaxWaitTime * US_PER_MS;
+    otError  error;
+
+    otLogDebgPlat("Wait pipelined responses: count=%u", mPipelinedRequestCount);
+
+    while (mPipelinedTids != 0)
+    {
+        uint64_t now = otPlatTimeGet();
+
+        if ((end <= now) || (mSpinelInterface.WaitForFrame(end - now) != OT_ERROR_NONE))
+        {
+            otLogWarnPlat("Wait for pipelined responses timeout");
+            HandleRcpTimeout();
+            ExitNow(error = OT_ERROR_RESPONSE_TIMEOUT);
+        }
+    }
+
+    error = mPipelinedError;
+    LogIfFail("Error waiting pipelined responses", error);
+
+    if (aSucceeded != nullptr)
+    {
+        *aSucceeded = mPipelinedSucceeded;
+    }
+
+    mPipelinedNumSent   = 0;
+    mPipelinedError     = OT_ERROR_NONE;
+    mPipelinedSucceeded = 0;
+
+exit:
+    return error;
+}
+
+template <typename InterfaceType> uint16_t RadioSpinel<InterfaceType>::CountLeadingSucceeded(uint16_t aSucceeded)
+{
+    uint16_t count = 0;
+
+    while (aSucceeded & (1 << count))
+    {
+        count++;
+    }
+
+    return count;
+}
+
 template <typename InterfaceType> spinel_tid_t RadioSpinel<InterfaceType>::GetNextTid(void)
 {
     spinel_tid_t tid = mCmdNextTid;
@@ -2090,6 +2340,12 @@ template <typename InterfaceType> void RadioSpinel<InterfaceType>::RecoverFromRc
     mError        = OT_ERROR_NONE;
     mIsTimeSynced = false;
 
+    mPipelinedTids         = 0;
+    mPipelinedRequestCount = 0;
+    mPipelinedNumSent      = 0;
+    mPipelinedError        = OT_ERROR_NONE;
+    mPipelinedSucceeded    = 0;
+
     ResetRcp(mResetRadioOnStartup);
     SuccessOrDie(Set(SPINEL_PROP_PHY_ENABLED, SPINEL_DATATYPE_BOOL_S, true));
     mState = kStateSleep;
@@ -2127,6 +2383,43 @@ exit:
 }
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+template <typename InterfaceType> void RadioSpinel<InterfaceType>::RecordSrcMatchShortEntry(uint16_t aShortAddress)
+{
+    assert(mSrcMatchShortEntryCount < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN);
+
+    for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
+    {
+        if (mSrcMatchShortEntries[i] == aShortAddress)
+        {
+            ExitNow();
+        }
+    }
+    mSrcMatchShortEntries[mSrcMatchShortEntryCount] = aShortAddress;
+    ++mSrcMatchShortEntryCount;
+
+exit:
+    return;
+}
+
+template <typename InterfaceType>
+void RadioSpinel<InterfaceType>::RecordSrcMatchExtEntry(const otExtAddress &aExtAddress)
+{
+    assert(mSrcMatchExtEntryCount < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN);
+
+    for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
+    {
+        if (memcmp(aExtAddress.m8, mSrcMatchExtEntries[i].m8, OT_EXT_ADDRESS_SIZE) == 0)
+        {
+            ExitNow();
+        }
+    }
+    mSrcMatchExtEntries[mSrcMatchExtEntryCount] = aExtAddress;
+    ++mSrcMatchExtEntryCount;
+
+exit:
+    return;
+}
+
 template <typename InterfaceType> void RadioSpinel<InterfaceType>::RestoreProperties(void)
 {
     Settings::NetworkInfo networkInfo;
@@ -2154,18 +2447,25 @@ template <typename InterfaceType> void RadioSpinel<InterfaceType>::RestoreProper
         }
     }
 
+    // Source match entries are independent of each other, so they
+    // are sent back to back rather than one round-trip at a time.
+
     for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
     {
-        SuccessOrDie(
-            Insert(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, mSrcMatchShortEntries[i]));
+        SuccessOrDie(SendPipelined(SPINEL_CMD_PROP_VALUE_INSERTED, SPINEL_CMD_PROP_VALUE_INSERT,
+                                   SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S,
+                                   mSrcMatchShortEntries[i]));
     }
 
     for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
     {
-        SuccessOrDie(
-            Insert(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, mSrcMatchExtEntries[i].m8));
+        SuccessOrDie(SendPipelined(SPINEL_CMD_PROP_VALUE_INSERTED, SPINEL_CMD_PROP_VALUE_INSERT,
+                                   SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S,
+                                   mSrcMatchExtEntries[i].m8));
     }
 
+    SuccessOrDie(WaitPipelinedResponses());
+
     if (mCcaEnergyDetectThresholdSet)
     {
         SuccessOrDie(Set(SPINEL_PROP_PHY_CCA_THRESHOLD, SPINEL_DATATYPE_INT8_S, mCcaEnergyDetectThreshold));
@@ -32,6 +32,8 @@
 
 #include "spinel_buffer.hpp"
 
+#include <string.h>
+
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 
@@ -763,13 +765,68 @@ uint8_t Buffer::OutFrameReadByte(void)
     return retval;
 }
 
+const uint8_t *Buffer::OutFrameReadChunk(uint16_t aMaxLength, uint16_t &aLength)
+{
+    const uint8_t *chunk = mReadPointer;
+    const uint8_t *end   = mReadPointer;
+
+    switch (mReadState)
+    {
+    case kReadStateInSegment:
+
+        // Segment bytes are contiguous only when read forward and up to the end of the buffer (wrap-around point).
+        if (mReadDirection == kForward)
+        {
+            end = (mReadSegmentTail > mReadPointer) ? mReadSegmentTail : mBufferEnd;
+        }
+
+        break;
+
+    case kReadStateInMessage:
+#if OPENTHREAD_SPINEL_CONFIG_OPENTHREAD_MESSAGE_ENABLE
+        end = mReadMessageTail;
+#endif
+        break;
+
+    default:
+        break;
+    }
+
+    // The last byte of the current part is left to `OutFrameReadByte()` which moves on to the next segment or message
+    // part (possibly refilling `mMessageBuffer` which `chunk` may point to).
+    aLength = (end > mReadPointer) ? static_cast<uint16_t>(end - mReadPointer - 1) : 0;
+
+    if (aLength > aMaxLength)
+    {
+        aLength = aMaxLength;
+    }
+
+    mReadPointer += aLength;
+
+    return chunk;
+}
+
 uint16_t Buffer::OutFrameRead(uint16_t aReadLength, uint8_t *aDataBuffer)
 {
     uint16_t bytesRead = 0;
 
-    for (bytesRead = 0; (bytesRead < aReadLength) && !OutFrameHasEnded(); bytesRead++)
+    while ((bytesRead < aReadLength) && !OutFrameHasEnded())
     {
-        *aDataBuffer++ = OutFrameReadByte();
+        uint16_t       chunkLength;
+        const uint8_t *chunk = OutFrameReadChunk(aReadLength - bytesRead, chunkLength);
+
+        if (chunkLength > 0)
+        {
+            memcpy(aDataBuffer, chunk, chunkLength);
+        }
+        else
+        {
+            chunkLength  = 1;
+            *aDataBuffer = OutFrameReadByte();
+        }
+
+        aDataBuffer += chunkLength;
+        bytesRead += chunkLength;
     }
 
     return bytesRead;
@@ -379,6 +379,25 @@ public:
      */
     uint8_t OutFrameReadByte(void);
 
+    /**
+     * Reads a contiguous run of bytes from the current output frame without copying them.
+     *
+     * The NCP buffer maintains a read offset for the current output frame being read. This method returns a pointer to
+     * the next bytes of the current frame, which are contiguous in memory, and moves the read offset forward past them.
+     * At most @p aMaxLength bytes are returned. The run never includes the last byte of a segment or of the current
+     * message buffer content, so the returned bytes stay valid until the next call to `OutFrameReadByte()`.
+     *
+     * If @p aLength is set to zero (e.g., the frame has ended, the next bytes are not contiguous in memory, or only a
+     * single byte remains in current part of frame), the caller should use `OutFrameReadByte()` to read the next byte.
+     *
+     * @param[in]  aMaxLength   Maximum number of bytes to read.
+     * @param[out] aLength      A reference to return the number of bytes read.
+     *
+     * @returns A pointer to the bytes read.
+     *
+     */
+    const uint8_t *OutFrameReadChunk(uint16_t aMaxLength, uint16_t &aLength);
+
     /**
      * Reads and copies bytes from the current output frame into a given buffer.
      *
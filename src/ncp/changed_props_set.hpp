@@ -146,6 +146,16 @@ public:
      */
     bool IsEntryChanged(uint8_t aIndex) const { return IsBitSet(mChangedSet, aIndex); }
 
+    /**
+     * Returns the index of the first entry in the set (i.e., the changed entry with the lowest index).
+     *
+     * MUST be used only when the set is not empty.
+     *
+     * @returns The index of the first entry in the set.
+     *
+     */
+    uint8_t GetFirstChangedEntryIndex(void) const { return FindFirstSetBit(mChangedSet); }
+
     /**
      * Removes an entry associated with an index in the set.
      *
@@ -203,6 +213,22 @@ private:
     static void ClearBit(uint64_t &aBitset, uint8_t aBitIndex) { aBitset &= ~(1ULL << aBitIndex); }
     static bool IsBitSet(uint64_t aBitset, uint8_t aBitIndex) { return (aBitset & (1ULL << aBitIndex)) != 0; }
 
+    static uint8_t FindFirstSetBit(uint64_t aBitset)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<uint8_t>(__builtin_ctzll(aBitset));
+#else
+        uint8_t index = 0;
+
+        while (!IsBitSet(aBitset, index))
+        {
+            index++;
+        }
+
+        return index;
+#endif
+    }
+
     static const Entry mSupportedProps[];
 
     uint64_t mChangedSet;
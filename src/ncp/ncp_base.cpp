@@ -827,26 +827,18 @@ void NcpBase::UpdateChangedProps(Tasklet &aTasklet)
 
 void NcpBase::UpdateChangedProps(void)
 {
-    uint8_t                       numEntries;
-    spinel_prop_key_t             propKey;
-    const ChangedPropsSet::Entry *entry;
-
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
     ProcessThreadChangedFlags();
 #endif
 
-    VerifyOrExit(!mChangedPropsSet.IsEmpty());
-
-    entry = mChangedPropsSet.GetSupportedEntries(numEntries);
+    // Visit only the changed entries, lowest index first, rather
+    // than checking every supported entry.
 
-    for (uint8_t index = 0; index < numEntries; index++, entry++)
+    while (!mChangedPropsSet.IsEmpty())
     {
-        if (!mChangedPropsSet.IsEntryChanged(index))
-        {
-            continue;
-        }
-
-        propKey = entry->mPropKey;
+        uint8_t                       index   = mChangedPropsSet.GetFirstChangedEntryIndex();
+        const ChangedPropsSet::Entry *entry   = mChangedPropsSet.GetEntry(index);
+        spinel_prop_key_t             propKey = entry->mPropKey;
 
         if (propKey == SPINEL_PROP_LAST_STATUS)
         {
@@ -865,7 +857,6 @@ void NcpBase::UpdateChangedProps(void)
         }
 
         mChangedPropsSet.RemoveEntry(index);
-        VerifyOrExit(!mChangedPropsSet.IsEmpty());
     }
 
 exit:
@@ -186,13 +186,24 @@ protected:
 
     otError HandleCommand(uint8_t aHeader);
 
+    static constexpr uint8_t kNumDirectIndexKeys  = 0x80; // Keys encoded in a single packed byte.
+    static constexpr uint8_t kInvalidHandlerIndex = 0xff;
+
 #if __cplusplus >= 201103L
-    static constexpr bool AreHandlerEntriesSorted(const HandlerEntry *aHandlerEntries, size_t aSize);
+    static constexpr bool    AreHandlerEntriesSorted(const HandlerEntry *aHandlerEntries, size_t aSize);
+    static constexpr uint8_t FindHandlerIndex(const HandlerEntry *aHandlerEntries,
+                                              size_t              aLow,
+                                              size_t              aHigh,
+                                              unsigned int        aKey);
 #endif
 
     static PropertyHandler FindPropertyHandler(const HandlerEntry *aHandlerEntries,
                                                size_t              aSize,
                                                spinel_prop_key_t   aKey);
+    static PropertyHandler FindPropertyHandler(const HandlerEntry *aHandlerEntries,
+                                               size_t              aSize,
+                                               const uint8_t      *aDirectIndex,
+                                               spinel_prop_key_t   aKey);
     static PropertyHandler FindGetPropertyHandler(spinel_prop_key_t aKey);
     static PropertyHandler FindSetPropertyHandler(spinel_prop_key_t aKey);
     static PropertyHandler FindInsertPropertyHandler(spinel_prop_key_t aKey);
@@ -42,6 +42,37 @@ constexpr bool NcpBase::AreHandlerEntriesSorted(const HandlerEntry *aHandlerEntr
                         AreHandlerEntriesSorted(aHandlerEntries, aSize - 1));
 }
 
+constexpr uint8_t NcpBase::FindHandlerIndex(const HandlerEntry *aHandlerEntries,
+                                            size_t              aLow,
+                                            size_t              aHigh,
+                                            unsigned int        aKey)
+{
+    return (aLow >= aHigh) ? kInvalidHandlerIndex
+           : (aHandlerEntries[(aLow + aHigh) / 2].mKey == aKey)
+               ? static_cast<uint8_t>((aLow + aHigh) / 2)
+           : (aHandlerEntries[(aLow + aHigh) / 2].mKey < aKey)
+               ? FindHandlerIndex(aHandlerEntries, (aLow + aHigh) / 2 + 1, aHigh, aKey)
+               : FindHandlerIndex(aHandlerEntries, aLow, (aLow + aHigh) / 2, aKey);
+}
+
+// Expands to the `kNumDirectIndexKeys` entries of a direct index table over the local `sHandlerEntries` array,
+// mapping each key to the index of its handler entry (or `kInvalidHandlerIndex`).
+
+#define OT_NCP_HANDLER_INDEX(aKey) FindHandlerIndex(sHandlerEntries, 0, OT_ARRAY_LENGTH(sHandlerEntries), (aKey))
+
+#define OT_NCP_HANDLER_INDEX_X8(aKey)                                                                         \
+    OT_NCP_HANDLER_INDEX((aKey) + 0), OT_NCP_HANDLER_INDEX((aKey) + 1), OT_NCP_HANDLER_INDEX((aKey) + 2),     \
+        OT_NCP_HANDLER_INDEX((aKey) + 3), OT_NCP_HANDLER_INDEX((aKey) + 4), OT_NCP_HANDLER_INDEX((aKey) + 5), \
+        OT_NCP_HANDLER_INDEX((aKey) + 6), OT_NCP_HANDLER_INDEX((aKey) + 7)
+
+#define OT_NCP_HANDLER_DIRECT_INDEX_TABLE()                                                          \
+    OT_NCP_HANDLER_INDEX_X8(0x00), OT_NCP_HANDLER_INDEX_X8(0x08), OT_NCP_HANDLER_INDEX_X8(0x10),     \
+        OT_NCP_HANDLER_INDEX_X8(0x18), OT_NCP_HANDLER_INDEX_X8(0x20), OT_NCP_HANDLER_INDEX_X8(0x28), \
+        OT_NCP_HANDLER_INDEX_X8(0x30), OT_NCP_HANDLER_INDEX_X8(0x38), OT_NCP_HANDLER_INDEX_X8(0x40), \
+        OT_NCP_HANDLER_INDEX_X8(0x48), OT_NCP_HANDLER_INDEX_X8(0x50), OT_NCP_HANDLER_INDEX_X8(0x58), \
+        OT_NCP_HANDLER_INDEX_X8(0x60), OT_NCP_HANDLER_INDEX_X8(0x68), OT_NCP_HANDLER_INDEX_X8(0x70), \
+        OT_NCP_HANDLER_INDEX_X8(0x78)
+
 NcpBase::PropertyHandler NcpBase::FindGetPropertyHandler(spinel_prop_key_t aKey)
 {
 #define OT_NCP_GET_HANDLER_ENTRY(aPropertyName)                   \
@@ -384,7 +415,15 @@ NcpBase::PropertyHandler NcpBase::FindGetPropertyHandler(spinel_prop_key_t aKey)
     static_assert(AreHandlerEntriesSorted(sHandlerEntries, OT_ARRAY_LENGTH(sHandlerEntries)),
                   "NCP property getter entries not sorted!");
 
+#if OPENTHREAD_CONFIG_NCP_DIRECT_PROPERTY_DISPATCH_ENABLE
+    static_assert(OT_ARRAY_LENGTH(sHandlerEntries) < kInvalidHandlerIndex, "Too many NCP property getter entries!");
+
+    constexpr static uint8_t sDirectIndex[kNumDirectIndexKeys] = {OT_NCP_HANDLER_DIRECT_INDEX_TABLE()};
+
+    return FindPropertyHandler(sHandlerEntries, OT_ARRAY_LENGTH(sHandlerEntries), sDirectIndex, aKey);
+#else
     return FindPropertyHandler(sHandlerEntries, OT_ARRAY_LENGTH(sHandlerEntries), aKey);
+#endif
 }
 
 NcpBase::PropertyHandler NcpBase::FindSetPropertyHandler(spinel_prop_key_t aKey)
@@ -637,7 +676,15 @@ NcpBase::PropertyHandler NcpBase::FindSetPropertyHandler(spinel_prop_key_t aKey)
     static_assert(AreHandlerEntriesSorted(sHandlerEntries, OT_ARRAY_LENGTH(sHandlerEntries)),
                   "NCP property setter entries not sorted!");
 
+#if OPENTHREAD_CONFIG_NCP_DIRECT_PROPERTY_DISPATCH_ENABLE
+    static_assert(OT_ARRAY_LENGTH(sHandlerEntries) < kInvalidHandlerIndex, "Too many NCP property setter entries!");
+
+    constexpr static uint8_t sDirectIndex[kNumDirectIndexKeys] = {OT_NCP_HANDLER_DIRECT_INDEX_TABLE()};
+
+    return FindPropertyHandler(sHandlerEntries, OT_ARRAY_LENGTH(sHandlerEntries), sDirectIndex, aKey);
+#else
     return FindPropertyHandler(sHandlerEntries, OT_ARRAY_LENGTH(sHandlerEntries), aKey);
+#endif
 }
 
 NcpBase::PropertyHandler NcpBase::FindInsertPropertyHandler(spinel_prop_key_t aKey)
@@ -774,5 +821,33 @@ NcpBase::PropertyHandler NcpBase::FindPropertyHandler(const HandlerEntry *aHandl
     return aHandlerEntries[l].mKey == aKey ? aHandlerEntries[l].mHandler : nullptr;
 }
 
+NcpBase::PropertyHandler NcpBase::FindPropertyHandler(const HandlerEntry *aHandlerEntries,
+                                                      size_t              aSize,
+                                                      const uint8_t      *aDirectIndex,
+                                                      spinel_prop_key_t   aKey)
+{
+    PropertyHandler handler = nullptr;
+
+    if (aKey < kNumDirectIndexKeys)
+    {
+        uint8_t index = aDirectIndex[aKey];
+
+        if (index != kInvalidHandlerIndex)
+        {
+            handler = aHandlerEntries[index].mHandler;
+        }
+    }
+    else
+    {
+        handler = FindPropertyHandler(aHandlerEntries, aSize, aKey);
+    }
+
+    return handler;
+}
+
+#undef OT_NCP_HANDLER_INDEX
+#undef OT_NCP_HANDLER_INDEX_X8
+#undef OT_NCP_HANDLER_DIRECT_INDEX_TABLE
+
 } // namespace Ncp
 } // namespace ot
@@ -179,6 +179,19 @@
 #define OPENTHREAD_CONFIG_NCP_ENABLE_MCU_POWER_STATE_CONTROL 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NCP_DIRECT_PROPERTY_DISPATCH_ENABLE
+ *
+ * Define to 1 to look up the get and set handlers of properties with a single-byte packed key (less than 0x80) from a
+ * direct index table built at compile time, instead of a binary search over the handler entries.
+ *
+ * This adds two 128-byte constant tables.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_DIRECT_PROPERTY_DISPATCH_ENABLE
+#define OPENTHREAD_CONFIG_NCP_DIRECT_PROPERTY_DISPATCH_ENABLE 1
+#endif
+
 /**
  * @def OPENTHREAD_ENABLE_NCP_VENDOR_HOOK
  *
@@ -154,6 +154,21 @@ void NcpHdlc::EncodeAndSend(void)
 
             while (!txFrameBuffer.OutFrameHasEnded())
             {
+#if !OPENTHREAD_ENABLE_NCP_SPINEL_ENCRYPTER
+                {
+                    // Encode contiguous runs of the frame directly from the tx frame buffer. Limiting the run to half
+                    // of the remaining space guarantees it fits even if every byte needs escaping.
+                    uint16_t       chunkLength;
+                    const uint8_t *chunk =
+                        txFrameBuffer.OutFrameReadChunk(mHdlcBuffer.GetRemainingLength() / 2, chunkLength);
+
+                    if (chunkLength > 0)
+                    {
+                        IgnoreError(mFrameEncoder.Encode(chunk, chunkLength));
+                        continue;
+                    }
+                }
+#endif
                 mByte = txFrameBuffer.OutFrameReadByte();
 
                 OT_FALL_THROUGH;
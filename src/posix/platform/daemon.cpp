@@ -114,6 +114,7 @@ int Daemon::OutputFormatV(const char *aFormat, va_list aArguments)
     if (rval < 0)
     {
         otLogWarnPlat("Failed to write CLI output: %s", strerror(errno));
+        Mainloop::Manager::Get().UnregisterFd(mSessionSocket);
         close(mSessionSocket);
         mSessionSocket = -1;
     }
@@ -150,6 +151,7 @@ void Daemon::InitializeSessionSocket(void)
 
     if (mSessionSocket != -1)
     {
+        Mainloop::Manager::Get().UnregisterFd(mSessionSocket);
         close(mSessionSocket);
     }
     mSessionSocket = newSessionSocket;
@@ -277,12 +279,14 @@ void Daemon::TearDown(void)
 
     if (mSessionSocket != -1)
     {
+        Mainloop::Manager::Get().UnregisterFd(mSessionSocket);
         close(mSessionSocket);
         mSessionSocket = -1;
     }
 
     if (mListenSocket != -1)
     {
+        Mainloop::Manager::Get().UnregisterFd(mListenSocket);
         close(mListenSocket);
         mListenSocket = -1;
     }
@@ -350,6 +354,7 @@ void Daemon::Process(const otSysMainloopContext &aContext)
 
     if (FD_ISSET(mSessionSocket, &aContext.mErrorFdSet))
     {
+        Mainloop::Manager::Get().UnregisterFd(mSessionSocket);
         close(mSessionSocket);
         mSessionSocket = -1;
     }
@@ -375,6 +380,7 @@ void Daemon::Process(const otSysMainloopContext &aContext)
             {
                 otLogWarnPlat("Daemon read: %s", strerror(errno));
             }
+            Mainloop::Manager::Get().UnregisterFd(mSessionSocket);
             close(mSessionSocket);
             mSessionSocket = -1;
         }
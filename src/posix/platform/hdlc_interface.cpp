@@ -62,6 +62,7 @@
 
 #include "common/code_utils.hpp"
 #include "lib/spinel/spinel.h"
+#include "posix/platform/mainloop.hpp"
 
 #ifdef __APPLE__
 
@@ -628,6 +629,7 @@ void HdlcInterface::CloseFile(void)
 {
     VerifyOrExit(mSockFd != -1);
 
+    Mainloop::Manager::Get().UnregisterFd(mSockFd);
     VerifyOrExit(0 == close(mSockFd), perror("close RCP"));
     VerifyOrExit(-1 != wait(nullptr) || errno == ECHILD, perror("wait RCP"));
 
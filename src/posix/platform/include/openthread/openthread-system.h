@@ -195,6 +195,31 @@ const char *otSysGetThreadNetifName(void);
  */
 unsigned int otSysGetThreadNetifIndex(void);
 
+/**
+ * Represents the counters of packets exchanged over the Thread network interface (TUN device).
+ *
+ */
+typedef struct otSysThreadNetifCounters
+{
+    uint32_t mRxReads;        ///< The number of `read()` calls on the TUN device.
+    uint32_t mRxPackets;      ///< The number of packets read from the TUN device.
+    uint32_t mRxBatches;      ///< The number of readiness events which yielded at least one packet.
+    uint32_t mRxMaxBatchSize; ///< The largest number of packets read in a single batch.
+    uint32_t mRxNoBufs;       ///< The number of packets dropped due to lack of message buffers.
+    uint32_t mTxPackets;      ///< The number of packets written to the TUN device.
+    uint32_t mTxFailures;     ///< The number of failed writes to the TUN device.
+} otSysThreadNetifCounters;
+
+/**
+ * Returns the counters of the Thread network interface.
+ *
+ * The counters remain zero when the platform network interface is not enabled.
+ *
+ * @returns The Thread network interface counters.
+ *
+ */
+const otSysThreadNetifCounters *otSysGetThreadNetifCounters(void);
+
 /**
  * Returns the infrastructure network interface name.
  *
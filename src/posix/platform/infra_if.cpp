@@ -431,12 +431,14 @@ void InfraNetif::Deinit(void)
 {
     if (mInfraIfIcmp6Socket != -1)
     {
+        Mainloop::Manager::Get().UnregisterFd(mInfraIfIcmp6Socket);
         close(mInfraIfIcmp6Socket);
         mInfraIfIcmp6Socket = -1;
     }
 
     if (mNetLinkSocket != -1)
     {
+        Mainloop::Manager::Get().UnregisterFd(mNetLinkSocket);
         close(mNetLinkSocket);
         mNetLinkSocket = -1;
     }
@@ -29,8 +29,20 @@
 #include "posix/platform/mainloop.hpp"
 
 #include <assert.h>
+#include <errno.h>
+#include <string.h>
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#include <sys/epoll.h>
+#endif
+
+#include <openthread/logging.h>
 
 #include "core/common/code_utils.hpp"
+#include "lib/platform/exit_code.h"
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE && !defined(__linux__)
+#error "OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE is only supported on Linux"
+#endif
 
 namespace ot {
 namespace Posix {
@@ -81,6 +93,235 @@ Manager &Manager::Get(void)
     return sInstance;
 }
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
+int Manager::Poll(otSysMainloopContext &aContext)
+{
+    // Registrations are level-triggered so that a file descriptor
+    // which is not fully drained by its source in `Process()` is
+    // reported again in the next iteration, which is the select()
+    // behavior all sources are written for.
+
+    struct epoll_event events[kMaxEpollEvents];
+    fd_set             readFdSet  = aContext.mReadFdSet;
+    fd_set             writeFdSet = aContext.mWriteFdSet;
+    fd_set             errorFdSet = aContext.mErrorFdSet;
+    fd_set             alwaysReadyFdSet;
+    bool               hasAlwaysReadyFd = false;
+    int                maxFd            = (aContext.mMaxFd > mMaxRegisteredFd) ? aContext.mMaxFd : mMaxRegisteredFd;
+    int                numEvents;
+    int                timeout;
+    int                rval = 0;
+
+    if (mEpollFd == -1)
+    {
+        mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+        VerifyOrDie(mEpollFd != -1, OT_EXIT_ERROR_ERRNO);
+    }
+
+    FD_ZERO(&alwaysReadyFdSet);
+
+    for (int fd = 0; fd <= maxFd; fd++)
+    {
+        uint8_t fdEvents    = 0;
+        bool    alwaysReady = false;
+
+        fdEvents |= FD_ISSET(fd, &readFdSet) ? kEventRead : 0;
+        fdEvents |= FD_ISSET(fd, &writeFdSet) ? kEventWrite : 0;
+        fdEvents |= FD_ISSET(fd, &errorFdSet) ? kEventError : 0;
+
+        VerifyOrExit(UpdateRegistration(fd, fdEvents, alwaysReady) == 0, rval = -1);
+
+        if (alwaysReady)
+        {
+            FD_SET(fd, &alwaysReadyFdSet);
+            hasAlwaysReadyFd = true;
+        }
+    }
+
+    if (hasAlwaysReadyFd)
+    {
+        timeout = 0;
+    }
+    else
+    {
+        timeout = static_cast<int>(aContext.mTimeout.tv_sec * 1000 + (aContext.mTimeout.tv_usec + 999) / 1000);
+    }
+
+    numEvents = epoll_wait(mEpollFd, events, kMaxEpollEvents, timeout);
+    VerifyOrExit(numEvents >= 0, rval = -1);
+
+    FD_ZERO(&aContext.mReadFdSet);
+    FD_ZERO(&aContext.mWriteFdSet);
+    FD_ZERO(&aContext.mErrorFdSet);
+
+    for (int i = 0; i < numEvents; i++)
+    {
+        int      fd       = events[i].data.fd;
+        uint32_t fdEvents = events[i].events;
+
+        // Map the epoll events back to the select() result, where an
+        // error or hang-up makes a descriptor readable and writable.
+
+        if (FD_ISSET(fd, &readFdSet) && (fdEvents & (EPOLLIN | EPOLLERR | EPOLLHUP)))
+        {
+            FD_SET(fd, &aContext.mReadFdSet);
+            rval++;
+        }
+
+        if (FD_ISSET(fd, &writeFdSet) && (fdEvents & (EPOLLOUT | EPOLLERR | EPOLLHUP)))
+        {
+            FD_SET(fd, &aContext.mWriteFdSet);
+            rval++;
+        }
+
+        if (FD_ISSET(fd, &errorFdSet) && (fdEvents & EPOLLPRI))
+        {
+            FD_SET(fd, &aContext.mErrorFdSet);
+            rval++;
+        }
+    }
+
+    for (int fd = 0; hasAlwaysReadyFd && (fd <= maxFd); fd++)
+    {
+        if (!FD_ISSET(fd, &alwaysReadyFdSet))
+        {
+            continue;
+        }
+
+        // Same as select(), a descriptor which does not support
+        // polling (e.g., a regular file) is always readable and
+        // writable.
+
+        if (FD_ISSET(fd, &readFdSet))
+        {
+            FD_SET(fd, &aContext.mReadFdSet);
+            rval++;
+        }
+
+        if (FD_ISSET(fd, &writeFdSet))
+        {
+            FD_SET(fd, &aContext.mWriteFdSet);
+            rval++;
+        }
+    }
+
+exit:
+    return rval;
+}
+
+int Manager::UpdateRegistration(int aFd, uint8_t aEvents, bool &aAlwaysReady)
+{
+    // Registrations persist across iterations, so the kernel is only
+    // called when the events requested for the descriptor change. A
+    // descriptor owner calls `UnregisterFd()` before closing it.
+
+    struct epoll_event event;
+    uint8_t            registeredEvents = mRegisteredEvents[aFd];
+    int                rval             = 0;
+
+    aAlwaysReady = false;
+
+    if (aEvents == 0)
+    {
+        VerifyOrExit(registeredEvents != 0);
+
+        if (!(registeredEvents & kEventAlwaysReady))
+        {
+            IgnoreReturnValue(epoll_ctl(mEpollFd, EPOLL_CTL_DEL, aFd, nullptr));
+        }
+
+        mRegisteredEvents[aFd] = 0;
+        ExitNow();
+    }
+
+    if (registeredEvents & kEventAlwaysReady)
+    {
+        aAlwaysReady           = true;
+        mRegisteredEvents[aFd] = aEvents | kEventAlwaysReady;
+        ExitNow();
+    }
+
+    VerifyOrExit(aEvents != registeredEvents);
+
+    memset(&event, 0, sizeof(event));
+    event.data.fd = aFd;
+
+    if (aEvents & kEventRead)
+    {
+        event.events |= EPOLLIN;
+    }
+
+    if (aEvents & kEventWrite)
+    {
+        event.events |= EPOLLOUT;
+    }
+
+    if (aEvents & kEventError)
+    {
+        event.events |= EPOLLPRI;
+    }
+
+    if (registeredEvents == 0)
+    {
+        rval = epoll_ctl(mEpollFd, EPOLL_CTL_ADD, aFd, &event);
+
+        if ((rval == -1) && (errno == EEXIST))
+        {
+            rval = epoll_ctl(mEpollFd, EPOLL_CTL_MOD, aFd, &event);
+        }
+    }
+    else
+    {
+        rval = epoll_ctl(mEpollFd, EPOLL_CTL_MOD, aFd, &event);
+
+        if ((rval == -1) && (errno == ENOENT))
+        {
+            // The descriptor was closed without `UnregisterFd()` and
+            // its number reused.
+            rval = epoll_ctl(mEpollFd, EPOLL_CTL_ADD, aFd, &event);
+        }
+    }
+
+    if ((rval == -1) && (errno == EPERM))
+    {
+        // The file does not support epoll (e.g., a regular file or
+        // /dev/null).
+        aAlwaysReady = true;
+        aEvents |= kEventAlwaysReady;
+        rval = 0;
+    }
+
+    VerifyOrExit(rval == 0);
+
+    mRegisteredEvents[aFd] = aEvents;
+
+    if (aFd > mMaxRegisteredFd)
+    {
+        mMaxRegisteredFd = aFd;
+    }
+
+exit:
+    return rval;
+}
+
+void Manager::UnregisterFd(int aFd)
+{
+    VerifyOrExit((aFd >= 0) && (aFd < FD_SETSIZE) && (mRegisteredEvents[aFd] != 0));
+
+    if (!(mRegisteredEvents[aFd] & kEventAlwaysReady))
+    {
+        IgnoreReturnValue(epoll_ctl(mEpollFd, EPOLL_CTL_DEL, aFd, nullptr));
+    }
+
+    mRegisteredEvents[aFd] = 0;
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
 } // namespace Mainloop
 } // namespace Posix
 } // namespace ot
@@ -34,7 +34,10 @@
 #ifndef OT_POSIX_PLATFORM_MAINLOOP_HPP_
 #define OT_POSIX_PLATFORM_MAINLOOP_HPP_
 
+#include "openthread-posix-config.h"
+
 #include <openthread/openthread-system.h>
+#include <openthread/platform/toolchain.h>
 
 namespace ot {
 namespace Posix {
@@ -122,7 +125,52 @@ public:
      */
     static Manager &Get(void);
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    /**
+     * Waits for events on the file descriptors in the mainloop context using epoll.
+     *
+     * The file descriptors stay registered with epoll across iterations, and `epoll_ctl()` is only called for a file
+     * descriptor whose requested events differ from the previous iteration. File descriptors which do not support
+     * epoll (e.g., regular files) are reported as ready without waiting. On return, the file descriptor sets in
+     * @p aContext contain only the ready file descriptors, as with select().
+     *
+     * @param[in,out]   aContext    A reference to the mainloop context.
+     *
+     * @returns The number of ready file descriptors, 0 on timeout, or -1 on error (with `errno` set).
+     *
+     */
+    int Poll(otSysMainloopContext &aContext);
+
+    /**
+     * Unregisters a file descriptor which is about to be closed.
+     *
+     * Must be called before closing a file descriptor which was added to the mainloop context. Otherwise a new file
+     * reusing the same descriptor number with the same events would not be registered with epoll.
+     *
+     * @param[in]   aFd     The file descriptor.
+     *
+     */
+    void UnregisterFd(int aFd);
+#else
+    void UnregisterFd(int aFd) { OT_UNUSED_VARIABLE(aFd); }
+#endif
+
 private:
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    static constexpr int kMaxEpollEvents = 64;
+
+    static constexpr uint8_t kEventRead        = 1 << 0;
+    static constexpr uint8_t kEventWrite       = 1 << 1;
+    static constexpr uint8_t kEventError       = 1 << 2;
+    static constexpr uint8_t kEventAlwaysReady = 1 << 3; // File descriptor does not support epoll.
+
+    int UpdateRegistration(int aFd, uint8_t aEvents, bool &aAlwaysReady);
+
+    int     mEpollFd                      = -1;
+    int     mMaxRegisteredFd              = -1;
+    uint8_t mRegisteredEvents[FD_SETSIZE] = {};
+#endif
+
     Source *mSources = nullptr;
 };
 
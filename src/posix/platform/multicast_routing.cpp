@@ -253,6 +253,7 @@ void MulticastRoutingManager::FinalizeMulticastRouterSock(void)
 {
     VerifyOrExit(IsEnabled());
 
+    Mainloop::Manager::Get().UnregisterFd(mMulticastRouterSock);
     close(mMulticastRouterSock);
     mMulticastRouterSock = -1;
 
@@ -148,11 +148,13 @@ extern int
 #include <openthread/nat64.h>
 #include <openthread/netdata.h>
 #include <openthread/platform/border_routing.h>
+#include <openthread/platform/messagepool.h>
 #include <openthread/platform/misc.h>
 
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "net/ip6_address.hpp"
+#include "posix/platform/mainloop.hpp"
 
 #include "resolver.hpp"
 
@@ -166,6 +168,10 @@ const char *otSysGetThreadNetifName(void) { return gNetifName; }
 
 unsigned int otSysGetThreadNetifIndex(void) { return gNetifIndex; }
 
+static otSysThreadNetifCounters sCounters;
+
+const otSysThreadNetifCounters *otSysGetThreadNetifCounters(void) { return &sCounters; }
+
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE
 #if OPENTHREAD_POSIX_CONFIG_FIREWALL_ENABLE
 #include "firewall.hpp"
@@ -284,7 +290,10 @@ enum
 };
 #endif
 
-static constexpr size_t kMaxIp6Size = OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH;
+static constexpr size_t   kMaxIp6Size     = OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH;
+static constexpr uint16_t kTunRxBatchSize = OPENTHREAD_POSIX_CONFIG_NETIF_TUN_RX_BATCH_SIZE;
+
+static_assert(kTunRxBatchSize > 0, "OPENTHREAD_POSIX_CONFIG_NETIF_TUN_RX_BATCH_SIZE must be at least 1");
 #if defined(RTM_NEWLINK) && defined(RTM_DELLINK)
 static bool sIsSyncingState = false;
 #endif
@@ -1013,12 +1022,14 @@ static void processReceive(otMessage *aMessage, void *aContext)
 #endif
 
     VerifyOrExit(write(sTunFd, packet, length) == length, perror("write"); error = OT_ERROR_FAILED);
+    sCounters.mTxPackets++;
 
 exit:
     otMessageFree(aMessage);
 
     if (error != OT_ERROR_NONE)
     {
+        sCounters.mTxFailures++;
         otLogWarnPlat("[netif] Failed to receive, error:%s", otThreadErrorToString(error));
     }
 }
@@ -1088,33 +1099,26 @@ exit:
 }
 #endif // OPENTHREAD_CONFIG_BORDER_ROUTING_DHCP6_PD_ENABLE
 
-static void processTransmit(otInstance *aInstance)
+static otError processTransmitPacket(otInstance *aInstance, char *aPacket, ssize_t aLength)
 {
     otMessage *message = nullptr;
-    ssize_t    rval;
-    char       packet[kMaxIp6Size];
-    otError    error  = OT_ERROR_NONE;
-    size_t     offset = 0;
+    otError    error   = OT_ERROR_NONE;
+    size_t     offset  = 0;
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE && OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
     bool isIp4 = false;
 #endif
 
-    assert(gInstance == aInstance);
-
-    rval = read(sTunFd, packet, sizeof(packet));
-    VerifyOrExit(rval > 0, error = OT_ERROR_FAILED);
-
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
     // BSD tunnel drivers have (for legacy reasons), may have a 4-byte header on them
-    if ((rval >= 4) && (packet[0] == 0) && (packet[1] == 0))
+    if ((aLength >= 4) && (aPacket[0] == 0) && (aPacket[1] == 0))
     {
-        rval -= 4;
+        aLength -= 4;
         offset = 4;
     }
 #endif
 
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_DHCP6_PD_ENABLE
-    if (tryProcessIcmp6RaMessage(aInstance, reinterpret_cast<uint8_t *>(&packet[offset]), rval) == OT_ERROR_NONE)
+    if (tryProcessIcmp6RaMessage(aInstance, reinterpret_cast<uint8_t *>(&aPacket[offset]), aLength) == OT_ERROR_NONE)
     {
         ExitNow();
     }
@@ -1126,7 +1130,7 @@ static void processTransmit(otInstance *aInstance)
         settings.mLinkSecurityEnabled = (otThreadGetDeviceRole(aInstance) != OT_DEVICE_ROLE_DISABLED);
         settings.mPriority            = OT_MESSAGE_PRIORITY_LOW;
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
-        isIp4   = (getIpVersion(reinterpret_cast<uint8_t *>(&packet[offset])) == kIpVersion4);
+        isIp4   = (getIpVersion(reinterpret_cast<uint8_t *>(&aPacket[offset])) == kIpVersion4);
         message = isIp4 ? otIp4NewMessage(aInstance, &settings) : otIp6NewMessage(aInstance, &settings);
 #else
         message = otIp6NewMessage(aInstance, &settings);
@@ -1135,11 +1139,11 @@ static void processTransmit(otInstance *aInstance)
     }
 
 #if OPENTHREAD_POSIX_LOG_TUN_PACKETS
-    otLogInfoPlat("[netif] Packet to NCP (%hu bytes)", static_cast<uint16_t>(rval));
-    otDumpInfoPlat("", &packet[offset], static_cast<size_t>(rval));
+    otLogInfoPlat("[netif] Packet to NCP (%hu bytes)", static_cast<uint16_t>(aLength));
+    otDumpInfoPlat("", &aPacket[offset], static_cast<size_t>(aLength));
 #endif
 
-    SuccessOrExit(error = otMessageAppend(message, &packet[offset], static_cast<uint16_t>(rval)));
+    SuccessOrExit(error = otMessageAppend(message, &aPacket[offset], static_cast<uint16_t>(aLength)));
 
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
     error = isIp4 ? otNat64Send(aInstance, message) : otIp6Send(aInstance, message);
@@ -1165,6 +1169,88 @@ exit:
             otLogWarnPlat("[netif] Failed to transmit, error:%s", otThreadErrorToString(error));
         }
     }
+
+    return error;
+}
+
+static uint16_t estimateMessageBuffers(size_t aLength)
+{
+    // Conservative estimate of the message buffers used by a packet of `aLength` bytes. The extra buffers cover a
+    // partially filled last buffer, the message metadata and the header space reserved by the IPv6 layer.
+
+    return static_cast<uint16_t>(aLength / (OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE - sizeof(otMessageBuffer)) + 3);
+}
+
+static void processTransmit(otInstance *aInstance)
+{
+    char     packet[kMaxIp6Size];
+    uint16_t count       = 0;
+    uint16_t freeBuffers = 0;
+
+    assert(gInstance == aInstance);
+
+    // Drain up to `kTunRxBatchSize` packets per readiness event. The batch ends early when the TUN device has no
+    // more packets queued, or when the message pool may not be able to take another packet of the maximum size (the
+    // remaining packets stay queued in the kernel until the next mainloop iteration). The first packet is always
+    // read, as before batching, so that the mainloop does not spin on a readable TUN device while the pool is full.
+    while (count < kTunRxBatchSize)
+    {
+        ssize_t rval;
+
+        if ((count > 0) && (freeBuffers < estimateMessageBuffers(kMaxIp6Size)))
+        {
+            break;
+        }
+
+        rval = read(sTunFd, packet, sizeof(packet));
+
+        sCounters.mRxReads++;
+
+        if (rval <= 0)
+        {
+            if ((rval < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK))
+            {
+                otLogWarnPlat("[netif] Failed to read from TUN device: %s", strerror(errno));
+            }
+
+            break;
+        }
+
+        count++;
+
+        if (processTransmitPacket(aInstance, packet, rval) == OT_ERROR_NO_BUFS)
+        {
+            sCounters.mRxNoBufs++;
+            break;
+        }
+
+        if (count == 1)
+        {
+            otBufferInfo bufferInfo;
+
+            otMessageGetBufferInfo(aInstance, &bufferInfo);
+            freeBuffers = bufferInfo.mFreeBuffers;
+        }
+        else
+        {
+            uint16_t numBuffers = estimateMessageBuffers(static_cast<size_t>(rval));
+
+            freeBuffers = (freeBuffers > numBuffers) ? (freeBuffers - numBuffers) : 0;
+        }
+    }
+
+    VerifyOrExit(count > 0);
+
+    sCounters.mRxPackets += count;
+    sCounters.mRxBatches++;
+
+    if (count > sCounters.mRxMaxBatchSize)
+    {
+        sCounters.mRxMaxBatchSize = count;
+    }
+
+exit:
+    return;
 }
 
 static void logAddrEvent(bool isAdd, const ot::Ip6::Address &aAddress, otError error)
@@ -2125,6 +2211,7 @@ void platformNetifDeinit(void)
 {
     if (sTunFd != -1)
     {
+        ot::Posix::Mainloop::Manager::Get().UnregisterFd(sTunFd);
         close(sTunFd);
         sTunFd = -1;
 
@@ -2135,12 +2222,14 @@ void platformNetifDeinit(void)
 
     if (sIpFd != -1)
     {
+        ot::Posix::Mainloop::Manager::Get().UnregisterFd(sIpFd);
         close(sIpFd);
         sIpFd = -1;
     }
 
     if (sNetlinkFd != -1)
     {
+        ot::Posix::Mainloop::Manager::Get().UnregisterFd(sNetlinkFd);
         close(sNetlinkFd);
         sNetlinkFd = -1;
     }
@@ -2148,6 +2237,7 @@ void platformNetifDeinit(void)
 #if OPENTHREAD_POSIX_USE_MLD_MONITOR
     if (sMLDMonitorFd != -1)
     {
+        ot::Posix::Mainloop::Manager::Get().UnregisterFd(sMLDMonitorFd);
         close(sMLDMonitorFd);
         sMLDMonitorFd = -1;
     }
@@ -2205,12 +2295,14 @@ void platformNetifProcess(const otSysMainloopContext *aContext)
 
     if (FD_ISSET(sTunFd, &aContext->mErrorFdSet))
     {
+        ot::Posix::Mainloop::Manager::Get().UnregisterFd(sTunFd);
         close(sTunFd);
         DieNow(OT_EXIT_FAILURE);
     }
 
     if (FD_ISSET(sNetlinkFd, &aContext->mErrorFdSet))
     {
+        ot::Posix::Mainloop::Manager::Get().UnregisterFd(sNetlinkFd);
         close(sNetlinkFd);
         DieNow(OT_EXIT_FAILURE);
     }
@@ -2218,6 +2310,7 @@ void platformNetifProcess(const otSysMainloopContext *aContext)
 #if OPENTHREAD_POSIX_USE_MLD_MONITOR
     if (FD_ISSET(sMLDMonitorFd, &aContext->mErrorFdSet))
     {
+        ot::Posix::Mainloop::Manager::Get().UnregisterFd(sMLDMonitorFd);
         close(sMLDMonitorFd);
         DieNow(OT_EXIT_FAILURE);
     }
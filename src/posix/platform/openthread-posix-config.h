@@ -125,6 +125,19 @@
 #define OPENTHREAD_POSIX_CONFIG_MAX_POWER_TABLE_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+ *
+ * Define as 1 to wait for mainloop events using epoll instead of select (Linux only).
+ *
+ * File descriptors stay registered with epoll across mainloop iterations. `epoll_ctl()` is only called when the events
+ * requested for a file descriptor change, and owners of mainloop file descriptors unregister them before closing.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_MAX_MULTICAST_FORWARDING_CACHE_TABLE
  *
@@ -159,6 +172,19 @@
 #define OPENTHREAD_POSIX_CONFIG_NETIF_PREFIX_ROUTE_METRIC 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_NETIF_TUN_RX_BATCH_SIZE
+ *
+ * The maximum number of packets read from the TUN device per readiness event of the mainloop.
+ *
+ * Reading stops earlier when the TUN device has no more packets queued or when the message pool may not be able to take
+ * another packet of the maximum size. Define as 1 to read a single packet per mainloop iteration.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_NETIF_TUN_RX_BATCH_SIZE
+#define OPENTHREAD_POSIX_CONFIG_NETIF_TUN_RX_BATCH_SIZE 8
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_INSTALL_OMR_ROUTES_ENABLE
  *
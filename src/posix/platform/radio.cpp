@@ -396,6 +396,51 @@ otError otPlatRadioAddSrcMatchExtEntry(otInstance *aInstance, const otExtAddress
     return sRadioSpinel.AddSrcMatchExtEntry(addr);
 }
 
+otError otPlatRadioAddSrcMatchShortEntries(otInstance           *aInstance,
+                                           const otShortAddress *aShortAddresses,
+                                           uint16_t              aNumEntries,
+                                           uint16_t             *aNumAdded)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    return sRadioSpinel.AddSrcMatchShortEntries(aShortAddresses, aNumEntries, *aNumAdded);
+}
+
+otError otPlatRadioAddSrcMatchExtEntries(otInstance         *aInstance,
+                                         const otExtAddress *aExtAddresses,
+                                         uint16_t            aNumEntries,
+                                         uint16_t           *aNumAdded)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    otError      error = OT_ERROR_NONE;
+    otExtAddress addrs[8];
+
+    *aNumAdded = 0;
+
+    while (error == OT_ERROR_NONE && *aNumAdded < aNumEntries)
+    {
+        uint16_t numEntries = aNumEntries - *aNumAdded;
+        uint16_t numAdded;
+
+        if (numEntries > OT_ARRAY_LENGTH(addrs))
+        {
+            numEntries = OT_ARRAY_LENGTH(addrs);
+        }
+
+        for (uint16_t i = 0; i < numEntries; i++)
+        {
+            for (size_t j = 0; j < sizeof(otExtAddress); j++)
+            {
+                addrs[i].m8[j] = aExtAddresses[*aNumAdded + i].m8[sizeof(otExtAddress) - 1 - j];
+            }
+        }
+
+        error = sRadioSpinel.AddSrcMatchExtEntries(addrs, numEntries, numAdded);
+        *aNumAdded += numAdded;
+    }
+
+    return error;
+}
+
 otError otPlatRadioClearSrcMatchShortEntry(otInstance *aInstance, uint16_t aShortAddress)
 {
     OT_UNUSED_VARIABLE(aInstance);
@@ -37,6 +37,7 @@
 #include <openthread/platform/time.h>
 
 #include "common/code_utils.hpp"
+#include "posix/platform/mainloop.hpp"
 
 #include <arpa/inet.h>
 #include <arpa/nameser.h>
@@ -251,6 +252,7 @@ void Resolver::CloseTransaction(Transaction *aTxn)
 {
     if (aTxn->mUdpFd >= 0)
     {
+        Mainloop::Manager::Get().UnregisterFd(aTxn->mUdpFd);
         close(aTxn->mUdpFd);
         aTxn->mUdpFd = -1;
     }
@@ -59,6 +59,8 @@
 #include <linux/ioctl.h>
 #include <linux/spi/spidev.h>
 
+#include "posix/platform/mainloop.hpp"
+
 namespace ot {
 namespace Posix {
 
@@ -198,6 +200,7 @@ void SpiInterface::Deinit(void)
 {
     if (mSpiDevFd >= 0)
     {
+        Mainloop::Manager::Get().UnregisterFd(mSpiDevFd);
         close(mSpiDevFd);
         mSpiDevFd = -1;
     }
@@ -210,6 +213,7 @@ void SpiInterface::Deinit(void)
 
     if (mIntGpioValueFd >= 0)
     {
+        Mainloop::Manager::Get().UnregisterFd(mIntGpioValueFd);
         close(mIntGpioValueFd);
         mIntGpioValueFd = -1;
     }
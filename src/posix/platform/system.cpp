@@ -371,8 +371,12 @@ int otSysMainloopPoll(otSysMainloopContext *aMainloop)
     else
 #endif
     {
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+        rval = ot::Posix::Mainloop::Manager::Get().Poll(*aMainloop);
+#else
         rval = select(aMainloop->mMaxFd + 1, &aMainloop->mReadFdSet, &aMainloop->mWriteFdSet, &aMainloop->mErrorFdSet,
                       &aMainloop->mTimeout);
+#endif
     }
 
     return rval;
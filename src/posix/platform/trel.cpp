@@ -48,6 +48,7 @@
 #include "radio_url.hpp"
 #include "system.hpp"
 #include "common/code_utils.hpp"
+#include "posix/platform/mainloop.hpp"
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 
@@ -435,6 +436,7 @@ void otPlatTrelDisable(otInstance *aInstance)
     assert(sInitialized);
     VerifyOrExit(sEnabled);
 
+    ot::Posix::Mainloop::Manager::Get().UnregisterFd(sSocket);
     close(sSocket);
     sSocket = -1;
     trelDnssdStopBrowse();
@@ -246,6 +246,7 @@ otError otPlatUdpClose(otUdpSocket *aUdpSocket)
     VerifyOrExit(aUdpSocket->mHandle != nullptr);
 
     fd = FdFromHandle(aUdpSocket->mHandle);
+    ot::Posix::Mainloop::Manager::Get().UnregisterFd(fd);
     VerifyOrExit(0 == close(fd), error = OT_ERROR_FAILED);
 
     aUdpSocket->mHandle = nullptr;
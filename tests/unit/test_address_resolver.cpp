@@ -0,0 +1,243 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "thread/address_resolver.hpp"
+#include "thread/mle_router.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_FTD
+
+static constexpr uint16_t kCacheEntries = OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES;
+static constexpr uint16_t kNumEids      = kCacheEntries * 3;
+static constexpr uint16_t kNumRloc16s   = 8;
+
+static Instance *sInstance;
+
+static uint16_t RlocForIndex(uint16_t aIndex) { return static_cast<uint16_t>((1 + (aIndex % kNumRloc16s)) << 10); }
+
+static void PrepareEid(uint16_t aIndex, Ip6::Address &aEid)
+{
+    // Prepares a unique EID for a given index. Pairs of consecutive
+    // indexes use the same IID with different prefixes.
+
+    SuccessOrQuit(aEid.FromString("fd00:1234::"));
+    aEid.mFields.m8[7]           = static_cast<uint8_t>(aIndex & 1);
+    aEid.GetIid().mFields.m16[3] = static_cast<uint16_t>(aIndex >> 1);
+}
+
+static bool FindInCache(const Ip6::Address &aEid, uint16_t &aRloc16)
+{
+    // Finds an EID by iterating over all cache entries.
+
+    AddressResolver::Iterator  iterator;
+    AddressResolver::EntryInfo entryInfo;
+    bool                       found = false;
+
+    iterator.Clear();
+
+    while (sInstance->Get<AddressResolver>().GetNextCacheEntry(entryInfo, iterator) == kErrorNone)
+    {
+        if (AsCoreType(&entryInfo.mTarget) == aEid)
+        {
+            VerifyOrQuit(!found, "EID is present in the cache more than once");
+            found   = true;
+            aRloc16 = entryInfo.mRloc16;
+        }
+    }
+
+    return found;
+}
+
+static void VerifyCache(const bool aRemoved[kNumEids])
+{
+    // Verifies that `LookUp()` finds exactly the EIDs present in the
+    // cache (through iteration) and that no removed EID is found.
+
+    uint16_t numFound = 0;
+
+    for (uint16_t i = 0; i < kNumEids; i++)
+    {
+        Ip6::Address eid;
+        uint16_t     rloc16;
+        bool         inCache;
+
+        PrepareEid(i, eid);
+        inCache = FindInCache(eid, rloc16);
+
+        VerifyOrQuit(!(inCache && aRemoved[i]));
+
+        if (inCache)
+        {
+            VerifyOrQuit(sInstance->Get<AddressResolver>().LookUp(eid) == rloc16);
+            numFound++;
+        }
+        else
+        {
+            VerifyOrQuit(sInstance->Get<AddressResolver>().LookUp(eid) == Mac::kShortAddrInvalid);
+        }
+    }
+
+    VerifyOrQuit(numFound <= kCacheEntries);
+}
+
+void TestAddressResolverCache(void)
+{
+    AddressResolver &resolver = sInstance->Get<AddressResolver>();
+    Mle::DeviceMode  mode(Mle::DeviceMode::kModeRxOnWhenIdle | Mle::DeviceMode::kModeFullThreadDevice |
+                         Mle::DeviceMode::kModeFullNetworkData);
+    uint16_t         dest;
+    bool             removed[kNumEids];
+
+    printf("TestAddressResolverCache()");
+
+    SuccessOrQuit(sInstance->Get<Mle::MleRouter>().SetDeviceMode(mode));
+    dest = sInstance->Get<Mac::Mac>().GetShortAddress();
+
+    for (uint8_t iteration = 0; iteration < 2; iteration++)
+    {
+        for (bool &entry : removed)
+        {
+            entry = false;
+        }
+
+        // Add snooped entries for more EIDs than the cache can hold,
+        // so older entries get evicted.
+
+        for (uint16_t i = 0; i < kNumEids; i++)
+        {
+            Ip6::Address eid;
+
+            PrepareEid(i, eid);
+            resolver.UpdateSnoopedCacheEntry(eid, RlocForIndex(i), dest);
+        }
+
+        VerifyCache(removed);
+
+        {
+            Ip6::Address eid;
+            uint16_t     rloc16;
+
+            PrepareEid(kNumEids - 1, eid);
+            VerifyOrQuit(FindInCache(eid, rloc16));
+            VerifyOrQuit(rloc16 == RlocForIndex(kNumEids - 1));
+        }
+
+        // Add entries for the first EIDs again, which now need to
+        // evict some of the more recent ones.
+
+        for (uint16_t i = 0; i < kCacheEntries / 2; i++)
+        {
+            Ip6::Address eid;
+
+            PrepareEid(i, eid);
+            resolver.UpdateSnoopedCacheEntry(eid, RlocForIndex(i), dest);
+        }
+
+        VerifyCache(removed);
+
+        // Remove every third EID.
+
+        for (uint16_t i = 0; i < kNumEids; i += 3)
+        {
+            Ip6::Address eid;
+
+            PrepareEid(i, eid);
+            resolver.RemoveEntryForAddress(eid);
+            removed[i] = true;
+        }
+
+        VerifyCache(removed);
+
+        // Remove all entries for one RLOC16.
+
+        resolver.RemoveEntriesForRloc16(RlocForIndex(1));
+
+        for (uint16_t i = 1; i < kNumEids; i += kNumRloc16s)
+        {
+            removed[i] = true;
+        }
+
+        VerifyCache(removed);
+
+        // Add snooped entries for the removed EIDs again.
+
+        for (uint16_t i = 0; i < kNumEids; i++)
+        {
+            Ip6::Address eid;
+
+            VerifyOrQuit(removed[i] || (i % 3 != 0));
+
+            if (removed[i])
+            {
+                PrepareEid(i, eid);
+                resolver.UpdateSnoopedCacheEntry(eid, RlocForIndex(i), dest);
+                removed[i] = false;
+            }
+        }
+
+        VerifyCache(removed);
+
+        resolver.Clear();
+
+        for (bool &entry : removed)
+        {
+            entry = true;
+        }
+
+        VerifyCache(removed);
+    }
+
+    printf(" -- PASS\n");
+}
+
+#endif // OPENTHREAD_FTD
+
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_FTD
+    ot::sInstance = testInitInstance();
+    VerifyOrQuit(ot::sInstance != nullptr);
+
+    ot::TestAddressResolverCache();
+
+    testFreeInstance(ot::sInstance);
+#endif
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
@@ -29,6 +29,7 @@
 #include <openthread/config.h>
 
 #include "common/debug.hpp"
+#include "common/num_utils.hpp"
 #include "crypto/aes_ccm.hpp"
 
 #include "test_platform.h"
@@ -253,11 +254,119 @@ void TestInPlaceAesCcmProcessing(void)
     testFreeInstance(instance);
 }
 
+/**
+ * Verifies AES-CCM against RFC 3610 Packet Vector #1, and verifies that feeding the header and payload in pieces of
+ * any size gives the same result as processing them in one call.
+ *
+ */
+void TestAesCcmPiecewiseProcessing(void)
+{
+    static constexpr uint8_t  kTagLength       = 8;
+    static constexpr uint32_t kRfcHeaderLength = 8;
+    static constexpr uint32_t kHeaderLength    = 37;
+    static constexpr uint32_t kPayloadLength   = 100;
+    static constexpr uint32_t kMaxPieceLength  = 40;
+
+    static const uint8_t kKey[] = {
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    };
+
+    static const uint8_t kNonce[] = {
+        0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5,
+    };
+
+    static const uint8_t kRfcEncrypted[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x58, 0x8c, 0x97, 0x9a, 0x61, 0xc6,
+        0x63, 0xd2, 0xf0, 0x66, 0xd0, 0xc2, 0xc0, 0xf9, 0x89, 0x80, 0x6d, 0x5f, 0x6b, 0x61,
+        0xda, 0xc3, 0x84, 0x17, 0xe8, 0xd1, 0x2c, 0xfd, 0xf9, 0x26, 0xe0,
+    };
+
+    uint8_t            rfcPacket[sizeof(kRfcEncrypted)];
+    uint8_t            plainText[kHeaderLength + kPayloadLength];
+    uint8_t            cipherText[kHeaderLength + kPayloadLength];
+    uint8_t            expected[kHeaderLength + kPayloadLength];
+    uint8_t            expectedTag[kTagLength];
+    uint8_t            tag[kTagLength];
+    ot::Crypto::AesCcm aesCcm;
+
+    printf("TestAesCcmPiecewiseProcessing\n");
+
+    aesCcm.SetKey(kKey, sizeof(kKey));
+
+    for (uint8_t i = 0; i < sizeof(rfcPacket) - kTagLength; i++)
+    {
+        rfcPacket[i] = i;
+    }
+
+    aesCcm.Init(kRfcHeaderLength, sizeof(rfcPacket) - kRfcHeaderLength - kTagLength, kTagLength, kNonce,
+                sizeof(kNonce));
+    aesCcm.Header(rfcPacket, kRfcHeaderLength);
+    aesCcm.Payload(rfcPacket + kRfcHeaderLength, rfcPacket + kRfcHeaderLength,
+                   sizeof(rfcPacket) - kRfcHeaderLength - kTagLength, ot::Crypto::AesCcm::kEncrypt);
+    aesCcm.Finalize(rfcPacket + sizeof(rfcPacket) - kTagLength);
+    VerifyOrQuit(memcmp(rfcPacket, kRfcEncrypted, sizeof(kRfcEncrypted)) == 0);
+
+    for (uint32_t i = 0; i < sizeof(plainText); i++)
+    {
+        plainText[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+
+    // Feeding one byte at a time never takes the whole-block
+    // path, so it serves as the reference.
+
+    for (uint32_t pieceLength = 1; pieceLength <= kMaxPieceLength; pieceLength++)
+    {
+        uint8_t *output = (pieceLength == 1) ? expected : cipherText;
+
+        memcpy(output, plainText, sizeof(plainText));
+
+        aesCcm.Init(kHeaderLength, kPayloadLength, kTagLength, kNonce, sizeof(kNonce));
+
+        for (uint32_t offset = 0; offset < kHeaderLength; offset += pieceLength)
+        {
+            aesCcm.Header(output + offset, ot::Min(pieceLength, kHeaderLength - offset));
+        }
+
+        for (uint32_t offset = kHeaderLength; offset < sizeof(plainText); offset += pieceLength)
+        {
+            uint32_t length = ot::Min(pieceLength, static_cast<uint32_t>(sizeof(plainText)) - offset);
+
+            aesCcm.Payload(output + offset, output + offset, length, ot::Crypto::AesCcm::kEncrypt);
+        }
+
+        aesCcm.Finalize((pieceLength == 1) ? expectedTag : tag);
+
+        if (pieceLength == 1)
+        {
+            continue;
+        }
+
+        VerifyOrQuit(memcmp(cipherText, expected, sizeof(expected)) == 0);
+        VerifyOrQuit(memcmp(tag, expectedTag, sizeof(expectedTag)) == 0);
+
+        aesCcm.Init(kHeaderLength, kPayloadLength, kTagLength, kNonce, sizeof(kNonce));
+        aesCcm.Header(cipherText, kHeaderLength);
+
+        for (uint32_t offset = kHeaderLength; offset < sizeof(plainText); offset += pieceLength)
+        {
+            uint32_t length = ot::Min(pieceLength, static_cast<uint32_t>(sizeof(plainText)) - offset);
+
+            aesCcm.Payload(cipherText + offset, cipherText + offset, length, ot::Crypto::AesCcm::kDecrypt);
+        }
+
+        aesCcm.Finalize(tag);
+
+        VerifyOrQuit(memcmp(cipherText, plainText, sizeof(plainText)) == 0);
+        VerifyOrQuit(memcmp(tag, expectedTag, sizeof(expectedTag)) == 0);
+    }
+}
+
 int main(void)
 {
     TestMacBeaconFrame();
     TestMacCommandFrame();
     TestInPlaceAesCcmProcessing();
+    TestAesCcmPiecewiseProcessing();
     printf("All tests passed\n");
     return 0;
 }
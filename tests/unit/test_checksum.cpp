@@ -464,6 +464,42 @@ public:
         VerifyOrQuit(checksum.GetValue() == kTestVectorChecksum);
         VerifyOrQuit(checksum.GetValue() == CalculateChecksum(kTestVector, sizeof(kTestVector)), );
     }
+
+    static void TestAddDataSplit(void)
+    {
+        // Verifies `AddData()` over random buffers added in two parts
+        // split at every possible (odd or even) offset, also starting
+        // at odd buffer alignments.
+
+        constexpr uint16_t kMaxSize = 67;
+
+        uint8_t   buffer[kMaxSize + 1];
+        Instance *instance = static_cast<Instance *>(testInitInstance());
+
+        VerifyOrQuit(instance != nullptr);
+
+        for (uint16_t size = 0; size <= kMaxSize; size++)
+        {
+            for (uint16_t start = 0; start <= 1; start++)
+            {
+                uint16_t expected;
+
+                Random::NonCrypto::FillBuffer(buffer, sizeof(buffer));
+                expected = CalculateChecksum(&buffer[start], size);
+
+                for (uint16_t split = 0; split <= size; split++)
+                {
+                    Checksum checksum;
+
+                    checksum.AddData(&buffer[start], split);
+                    checksum.AddData(&buffer[start + split], size - split);
+                    VerifyOrQuit(checksum.GetValue() == expected);
+                }
+            }
+        }
+
+        testFreeInstance(instance);
+    }
 };
 
 } // namespace ot
@@ -471,6 +507,7 @@ public:
 int main(void)
 {
     ot::ChecksumTester::TestExampleVector();
+    ot::ChecksumTester::TestAddDataSplit();
     ot::TestUdpMessageChecksum();
     ot::TestIcmp6MessageChecksum();
     ot::TestTcp4MessageChecksum();
@@ -73,6 +73,7 @@ static bool StateMatchesFilter(Child::State aState, Child::StateFilter aFilter)
     bool  rval = false;
     Child child;
 
+    child.Init(*sInstance);
     child.SetState(aState);
 
     switch (aFilter)
@@ -393,11 +394,116 @@ void TestChildTable(void)
     testFreeInstance(sInstance);
 }
 
+void TestChildTableIndex(void)
+{
+    static constexpr uint16_t kNumTestChildren = kMaxChildren;
+
+    ChildTable     *table;
+    Child          *children[kNumTestChildren];
+    Mac::ExtAddress extAddress;
+
+    printf("Test ChildTable index");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    table = &sInstance->Get<ChildTable>();
+
+    // Add children whose RLOC16 values share the same child ID under
+    // different router IDs so that index chains contain more than one
+    // entry.
+
+    for (uint16_t i = 0; i < kNumTestChildren; i++)
+    {
+        children[i] = table->GetNewChild();
+        VerifyOrQuit(children[i] != nullptr);
+
+        extAddress.GenerateRandom();
+        children[i]->SetExtAddress(extAddress);
+        children[i]->SetRloc16(static_cast<uint16_t>(((i % 4) << Mle::kRouterIdOffset) | (i / 4 + 1)));
+        children[i]->SetState(Child::kStateValid);
+    }
+
+    for (Child *child : children)
+    {
+        VerifyOrQuit(table->FindChild(child->GetRloc16(), Child::kInStateValid) == child);
+        VerifyOrQuit(table->FindChild(child->GetExtAddress(), Child::kInStateValid) == child);
+        VerifyOrQuit(table->FindChild(child->GetRloc16(), Child::kInStateChildIdRequest) == nullptr);
+    }
+
+    // Change the RLOC16 and Extended Address of a child and verify
+    // that it is no longer found using its old addresses.
+
+    {
+        Child          *child     = children[0];
+        uint16_t        oldRloc16 = child->GetRloc16();
+        Mac::ExtAddress oldExtAddress;
+
+        oldExtAddress = child->GetExtAddress();
+
+        extAddress.GenerateRandom();
+        child->SetExtAddress(extAddress);
+        child->SetRloc16(0x7c00 | Mle::kMaxChildId);
+
+        VerifyOrQuit(table->FindChild(oldRloc16, Child::kInStateValid) == nullptr);
+        VerifyOrQuit(table->FindChild(oldExtAddress, Child::kInStateValid) == nullptr);
+        VerifyOrQuit(table->FindChild(child->GetRloc16(), Child::kInStateValid) == child);
+        VerifyOrQuit(table->FindChild(extAddress, Child::kInStateValid) == child);
+    }
+
+    // Move children through different states and verify lookups.
+
+    for (uint16_t i = 0; i < kNumTestChildren; i += 2)
+    {
+        children[i]->SetState(Child::kStateInvalid);
+    }
+
+    for (uint16_t i = 0; i < kNumTestChildren; i++)
+    {
+        Child *expected = (i % 2 == 0) ? nullptr : children[i];
+
+        VerifyOrQuit(table->FindChild(children[i]->GetRloc16(), Child::kInStateAnyExceptInvalid) == expected);
+        VerifyOrQuit(table->FindChild(children[i]->GetExtAddress(), Child::kInStateAnyExceptInvalid) == expected);
+        VerifyOrQuit(table->FindChild(children[i]->GetRloc16(), Child::kInStateAny) == children[i]);
+    }
+
+    for (uint16_t i = 0; i < kNumTestChildren; i += 2)
+    {
+        children[i]->SetState(Child::kStateRestored);
+    }
+
+    for (Child *child : children)
+    {
+        VerifyOrQuit(table->FindChild(child->GetRloc16(), Child::kInStateValidOrRestoring) == child);
+        VerifyOrQuit(table->FindChild(child->GetExtAddress(), Child::kInStateValidOrRestoring) == child);
+    }
+
+    // Re-use an entry through `GetNewChild()` after it becomes invalid.
+
+    children[1]->SetState(Child::kStateInvalid);
+    extAddress = children[1]->GetExtAddress();
+
+    VerifyOrQuit(table->GetNewChild() == children[1]);
+    VerifyOrQuit(table->FindChild(extAddress, Child::kInStateAny) == nullptr);
+
+    table->Clear();
+
+    for (Child *child : children)
+    {
+        VerifyOrQuit(table->FindChild(child->GetRloc16(), Child::kInStateAnyExceptInvalid) == nullptr);
+    }
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestChildTable();
+    ot::TestChildTableIndex();
     printf("\nAll tests passed.\n");
     return 0;
 }
@@ -0,0 +1,184 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "coap/coap.hpp"
+#include "common/instance.hpp"
+#include "thread/tmf.hpp"
+
+#include "test_util.h"
+
+namespace ot {
+namespace Coap {
+
+static Instance *sInstance;
+
+static Message *NewResponse(uint16_t aMessageId)
+{
+    Message *message = sInstance->Get<Tmf::Agent>().NewMessage();
+
+    VerifyOrQuit(message != nullptr);
+    message->Init(kTypeAck, kCodeChanged);
+    message->SetMessageId(aMessageId);
+    SuccessOrQuit(message->AppendBytes(&aMessageId, sizeof(aMessageId)));
+
+    return message;
+}
+
+static uint16_t CountResponses(const ResponsesQueue &aQueue)
+{
+    uint16_t count = 0;
+
+    for (const ot::Message &message : aQueue.GetResponses())
+    {
+        OT_UNUSED_VARIABLE(message);
+        count++;
+    }
+
+    return count;
+}
+
+static bool HasResponse(ResponsesQueue &aQueue, uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo)
+{
+    Message *request  = NewResponse(aMessageId);
+    Message *response = nullptr;
+    uint16_t length   = request->GetLength();
+    Error    error;
+
+    error = aQueue.GetMatchedResponseCopy(*request, aMessageInfo, &response);
+    request->Free();
+
+    if (error == kErrorNone)
+    {
+        // The copy must not carry any cache bookkeeping data.
+        VerifyOrQuit(response->GetMessageId() == aMessageId);
+        VerifyOrQuit(response->GetLength() == length);
+        response->Free();
+    }
+    else
+    {
+        VerifyOrQuit(error == kErrorNotFound);
+    }
+
+    return (error == kErrorNone);
+}
+
+void TestResponsesQueue(void)
+{
+    static constexpr uint16_t kMaxResponses = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES;
+    static constexpr uint16_t kBaseId       = 0x1200;
+
+    Ip6::MessageInfo messageInfo;
+    Ip6::MessageInfo otherPeerInfo;
+    Ip6::MessageInfo otherPortInfo;
+    Message         *response;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    {
+        ResponsesQueue queue(*sInstance);
+
+        SuccessOrQuit(messageInfo.GetPeerAddr().FromString("fd00::1"));
+        messageInfo.SetPeerPort(Tmf::kUdpPort);
+
+        otherPeerInfo = messageInfo;
+        SuccessOrQuit(otherPeerInfo.GetPeerAddr().FromString("fd00::2"));
+
+        otherPortInfo = messageInfo;
+        otherPortInfo.SetPeerPort(Tmf::kUdpPort + 1);
+
+        // Add a single response and check the match on Message ID and peer endpoint.
+
+        response = NewResponse(kBaseId);
+        queue.EnqueueResponse(*response, messageInfo, TxParameters::GetDefault());
+        response->Free();
+
+        VerifyOrQuit(CountResponses(queue) == 1);
+        VerifyOrQuit(HasResponse(queue, kBaseId, messageInfo));
+        VerifyOrQuit(!HasResponse(queue, kBaseId + 1, messageInfo));
+        VerifyOrQuit(!HasResponse(queue, kBaseId, otherPeerInfo));
+        VerifyOrQuit(!HasResponse(queue, kBaseId, otherPortInfo));
+
+        // A duplicate response is not added again, the same Message ID from another peer is.
+
+        response = NewResponse(kBaseId);
+        queue.EnqueueResponse(*response, messageInfo, TxParameters::GetDefault());
+        queue.EnqueueResponse(*response, otherPeerInfo, TxParameters::GetDefault());
+        response->Free();
+
+        VerifyOrQuit(CountResponses(queue) == 2);
+        VerifyOrQuit(HasResponse(queue, kBaseId, messageInfo));
+        VerifyOrQuit(HasResponse(queue, kBaseId, otherPeerInfo));
+
+        // Fill the cache, the oldest responses are evicted once it is full.
+
+        for (uint16_t id = kBaseId + 1; id < kBaseId + kMaxResponses; id++)
+        {
+            response = NewResponse(id);
+            queue.EnqueueResponse(*response, messageInfo, TxParameters::GetDefault());
+            response->Free();
+
+            VerifyOrQuit(CountResponses(queue) <= kMaxResponses);
+        }
+
+        VerifyOrQuit(CountResponses(queue) == kMaxResponses);
+        VerifyOrQuit(!HasResponse(queue, kBaseId, messageInfo));
+
+        for (uint16_t id = kBaseId + 1; id < kBaseId + kMaxResponses; id++)
+        {
+            VerifyOrQuit(HasResponse(queue, id, messageInfo));
+        }
+
+        queue.DequeueAllResponses();
+
+        VerifyOrQuit(CountResponses(queue) == 0);
+
+        for (uint16_t id = kBaseId; id < kBaseId + kMaxResponses; id++)
+        {
+            VerifyOrQuit(!HasResponse(queue, id, messageInfo));
+        }
+    }
+
+    testFreeInstance(sInstance);
+
+    printf("TestResponsesQueue passed\n");
+}
+
+} // namespace Coap
+} // namespace ot
+
+int main(void)
+{
+    ot::Coap::TestResponsesQueue();
+    printf("All tests passed\n");
+    return 0;
+}
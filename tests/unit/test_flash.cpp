@@ -148,6 +148,61 @@ void TestFlash(void)
     VerifyOrQuit(flash.Delete(0, 0) == kErrorNotFound);
     VerifyOrQuit(flash.Get(0, 0, nullptr, nullptr) == kErrorNotFound);
 
+    // Many records with the same key, interleaved with other keys
+
+    for (uint16_t index = 0; index < 40; index++)
+    {
+        writeBuffer[0] = static_cast<uint8_t>(index);
+        SuccessOrQuit(flash.Add(1, writeBuffer, 1));
+        SuccessOrQuit(flash.Set(2, writeBuffer, 1));
+    }
+
+    for (int index = 39; index >= 0; index--)
+    {
+        uint16_t length = sizeof(readBuffer);
+
+        SuccessOrQuit(flash.Get(1, index, readBuffer, &length));
+        VerifyOrQuit(length == 1, "Get() did not return expected length");
+        VerifyOrQuit(readBuffer[0] == index, "Get() did not return expected value");
+    }
+
+    VerifyOrQuit(flash.Get(1, 40, nullptr, nullptr) == kErrorNotFound);
+
+    // Delete every third value and check the remaining ones in order
+
+    for (int index = 39; index >= 0; index -= 3)
+    {
+        SuccessOrQuit(flash.Delete(1, index));
+    }
+
+    for (uint16_t index = 0, value = 0; index < 26; index++, value++)
+    {
+        uint16_t length = sizeof(readBuffer);
+
+        if ((value % 3) == 0)
+        {
+            value++;
+        }
+
+        SuccessOrQuit(flash.Get(1, index, readBuffer, &length));
+        VerifyOrQuit(length == 1, "Get() did not return expected length");
+        VerifyOrQuit(readBuffer[0] == value, "Get() did not return expected value");
+    }
+
+    VerifyOrQuit(flash.Get(1, 26, nullptr, nullptr) == kErrorNotFound);
+
+    {
+        uint16_t length = sizeof(readBuffer);
+
+        SuccessOrQuit(flash.Get(2, 0, readBuffer, &length));
+        VerifyOrQuit(readBuffer[0] == 39, "Get() did not return expected value");
+        VerifyOrQuit(flash.Get(2, 1, nullptr, nullptr) == kErrorNotFound);
+    }
+
+    SuccessOrQuit(flash.Delete(1, -1));
+    SuccessOrQuit(flash.Delete(2, -1));
+    VerifyOrQuit(flash.Get(1, 0, nullptr, nullptr) == kErrorNotFound);
+
     // Wipe()
 
     for (uint16_t key = 0; key < 16; key++)
@@ -121,6 +121,14 @@ void TestHdlcFrameBuffer(void)
     VerifyOrQuit(frameBuffer.CanWrite(1) == false, "did not fail with full buffer");
     VerifyOrQuit(frameBuffer.WriteByte(0) == OT_ERROR_NO_BUFS, "did not fail with full buffer");
 
+    frameBuffer.Clear();
+    SuccessOrQuit(frameBuffer.WriteData(sHelloText, sizeof(sHelloText) - 1));
+    VerifyOrQuit(frameBuffer.GetLength() == sizeof(sHelloText) - 1);
+    VerifyOrQuit(memcmp(frameBuffer.GetFrame(), sHelloText, frameBuffer.GetLength()) == 0);
+    VerifyOrQuit(frameBuffer.GetRemainingLength() == kBufferSize - (sizeof(sHelloText) - 1));
+    VerifyOrQuit(frameBuffer.WriteData(sHelloText, frameBuffer.GetRemainingLength() + 1) == OT_ERROR_NO_BUFS);
+    VerifyOrQuit(frameBuffer.GetLength() == sizeof(sHelloText) - 1, "WriteData() changed buffer on failure");
+
     printf(" -- PASS\n");
 }
 
@@ -576,6 +584,25 @@ void TestEncoderDecoder(void)
 
     decoderBuffer.Clear();
 
+    // Test `Decoder` behavior when running out of buffer space
+
+    {
+        Spinel::FrameBuffer<sizeof(sMottoText) / 2> smallBuffer;
+        Hdlc::Decoder                               smallDecoder(smallBuffer, ProcessDecodedFrame, &decoderContext);
+
+        encoderBuffer.Clear();
+        SuccessOrQuit(encoder.BeginFrame());
+        SuccessOrQuit(encoder.Encode(sMottoText, sizeof(sMottoText) - 1));
+        SuccessOrQuit(encoder.EndFrame());
+
+        decoderContext.mWasCalled = false;
+        smallDecoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+        VerifyOrQuit(decoderContext.mWasCalled);
+        VerifyOrQuit(decoderContext.mError == OT_ERROR_NO_BUFS, "Decoder::Decode() did not fail with a full buffer");
+        VerifyOrQuit(smallBuffer.GetLength() == sizeof(sMottoText) / 2);
+        VerifyOrQuit(memcmp(smallBuffer.GetFrame(), sMottoText, smallBuffer.GetLength()) == 0);
+    }
+
     // Test `Decoder` with back to back `kFlagSequence` and ensure callback is not invoked.
 
     byte                      = kFlagSequence;
@@ -769,6 +769,78 @@ void TestMacFrameAckGeneration(void)
 #endif // (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
 }
 
+void TestMacFrameSecurityProcessing(void)
+{
+    static const uint8_t kKey[] = {
+        0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff,
+    };
+    static const uint8_t kExtAddr[] = {0x48, 0xde, 0xac, 0x00, 0x00, 0x00, 0x00, 0x01};
+    static const uint8_t kPayload[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c,
+                                       0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17};
+
+    uint8_t          psdu1[OT_RADIO_FRAME_MAX_SIZE];
+    uint8_t          psdu2[OT_RADIO_FRAME_MAX_SIZE];
+    Mac::TxFrame     txFrame1;
+    Mac::TxFrame     txFrame2;
+    Mac::TxFrame    *txFrames[] = {&txFrame1, &txFrame2};
+    Mac::RxFrame     rxFrame;
+    Mac::Addresses   addresses;
+    Mac::PanIds      panIds;
+    Mac::ExtAddress  extAddr;
+    Mac::Key         key;
+    Mac::KeyMaterial keyMaterial;
+    Crypto::AesCcm   aesCcm;
+
+    printf("TestMacFrameSecurityProcessing\n");
+
+    extAddr.Set(kExtAddr);
+    addresses.mSource.SetExtended(extAddr);
+    addresses.mDestination.SetShort(0x1234);
+    panIds.SetSource(0xface);
+    panIds.SetDestination(0xface);
+
+    memcpy(key.m8, kKey, sizeof(key.m8));
+    keyMaterial.SetFrom(key);
+    aesCcm.SetKey(keyMaterial);
+
+    txFrame1.mPsdu = psdu1;
+    txFrame2.mPsdu = psdu2;
+
+    for (Mac::TxFrame *txFrame : txFrames)
+    {
+        txFrame->mLength    = 0;
+        txFrame->mRadioType = 0;
+        txFrame->InitMacHeader(Mac::Frame::kTypeData, Mac::Frame::kVersion2006, addresses, panIds,
+                               Mac::Frame::kSecurityEncMic32, Mac::Frame::kKeyIdMode1);
+        txFrame->SetFrameCounter(0x1234);
+        txFrame->SetKeyId(1);
+        txFrame->SetPayloadLength(sizeof(kPayload));
+        memcpy(txFrame->GetPayload(), kPayload, sizeof(kPayload));
+        txFrame->SetAesKey(keyMaterial);
+    }
+
+    // Securing with an already keyed `AesCcm` must match securing
+    // with the key material. The same `AesCcm` is used twice to
+    // check that it can be reused across frames.
+
+    txFrame1.ProcessTransmitAesCcm(extAddr);
+    txFrame2.ProcessTransmitAesCcm(extAddr, aesCcm);
+
+    VerifyOrQuit(txFrame1.GetLength() == txFrame2.GetLength());
+    VerifyOrQuit(memcmp(psdu1, psdu2, txFrame1.GetLength() - txFrame1.GetFcsSize()) == 0);
+    VerifyOrQuit(memcmp(txFrame1.GetPayload(), kPayload, sizeof(kPayload)) != 0);
+
+    rxFrame.mPsdu      = psdu2;
+    rxFrame.mLength    = txFrame2.GetLength();
+    rxFrame.mRadioType = 0;
+    SuccessOrQuit(rxFrame.ProcessReceiveAesCcm(extAddr, aesCcm));
+    VerifyOrQuit(memcmp(rxFrame.GetPayload(), kPayload, sizeof(kPayload)) == 0);
+
+    rxFrame.mPsdu = psdu1;
+    rxFrame.GetPayload()[0] ^= 0xff;
+    VerifyOrQuit(rxFrame.ProcessReceiveAesCcm(extAddr, keyMaterial) == kErrorSecurity);
+}
+
 } // namespace ot
 
 int main(void)
@@ -778,6 +850,7 @@ int main(void)
     ot::TestMacChannelMask();
     ot::TestMacFrameApi();
     ot::TestMacFrameAckGeneration();
+    ot::TestMacFrameSecurityProcessing();
     printf("All tests passed\n");
     return 0;
 }
@@ -31,6 +31,7 @@
 #include <openthread/config.h>
 
 #include "test_util.hpp"
+#include "common/crc16.hpp"
 #include "meshcop/meshcop.hpp"
 #include "meshcop/timestamp.hpp"
 
@@ -113,6 +114,42 @@ void TestSteeringData(void)
     printf("TestSteeringData() passed\n");
 }
 
+void TestCrc16(void)
+{
+    // Check values from the CRC catalogue for "123456789": CRC-16/XMODEM
+    // (CCITT polynomial) and CRC-16/UMTS (ANSI polynomial).
+
+    const uint8_t  kData[]     = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    const uint16_t kCcittCheck = 0x31c3;
+    const uint16_t kAnsiCheck  = 0xfee8;
+
+    Crc16 ccitt(Crc16::kCcitt);
+    Crc16 ansi(Crc16::kAnsi);
+
+    VerifyOrQuit(ccitt.Get() == 0);
+    VerifyOrQuit(ansi.Get() == 0);
+
+    ccitt.Update(kData, sizeof(kData));
+    ansi.Update(kData, sizeof(kData));
+
+    VerifyOrQuit(ccitt.Get() == kCcittCheck);
+    VerifyOrQuit(ansi.Get() == kAnsiCheck);
+
+    ccitt.Init();
+    ansi.Init();
+
+    for (uint8_t byte : kData)
+    {
+        ccitt.Update(byte);
+        ansi.Update(byte);
+    }
+
+    VerifyOrQuit(ccitt.Get() == kCcittCheck);
+    VerifyOrQuit(ansi.Get() == kAnsiCheck);
+
+    printf("TestCrc16() passed\n");
+}
+
 void TestTimestamp(void)
 {
     MeshCoP::Timestamp t1;
@@ -158,6 +195,7 @@ void TestTimestamp(void)
 int main(void)
 {
     ot::TestSteeringData();
+    ot::TestCrc16();
     ot::TestTimestamp();
     printf("\nAll tests passed.\n");
     return 0;
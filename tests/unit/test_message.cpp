@@ -306,6 +306,27 @@ void TestMessage(void)
         }
     }
 
+    // Verify that a failed `SetLength()` (not enough free buffers)
+    // leaves the message and the pool unchanged.
+
+    VerifyOrQuit((message = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+    SuccessOrQuit(message->AppendBytes(writeBuffer, kMaxSize));
+
+    {
+        uint16_t freeBuffers = messagePool->GetFreeBufferCount();
+        uint8_t  numBuffers  = message->GetBufferCount();
+
+        VerifyOrQuit(message->SetLength(kMaxSize + (freeBuffers + 1) * kBufferSize) == kErrorNoBufs);
+        VerifyOrQuit(messagePool->GetFreeBufferCount() == freeBuffers);
+        VerifyOrQuit(message->GetBufferCount() == numBuffers);
+        VerifyOrQuit(message->GetLength() == kMaxSize);
+
+        SuccessOrQuit(message->Read(0, readBuffer, kMaxSize));
+        VerifyOrQuit(memcmp(readBuffer, writeBuffer, kMaxSize) == 0);
+    }
+
+    message->Free();
+
     testFreeInstance(instance);
 }
 
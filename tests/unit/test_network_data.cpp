@@ -924,6 +924,156 @@ void TestNetworkDataDsnSrpAnycastSeqNumSelection(void)
     testFreeInstance(instance);
 }
 
+void TestNetworkDataLeaderLookups(void)
+{
+    class TestLeader : public Leader
+    {
+    public:
+        void Populate(const uint8_t *aTlvs, uint8_t aTlvsLength)
+        {
+            memcpy(GetBytes(), aTlvs, aTlvsLength);
+            SetLength(aTlvsLength);
+            SignalNetDataChanged();
+        }
+    };
+
+    const uint8_t kNetworkData[] = {
+        // Prefix 2001:db8:1::/48, Border Router 0x2800 (on-mesh, default route), Context ID 1 (compress).
+        0x03, 0x12, 0x00, 0x30, 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x05, 0x04, 0x28, 0x00, 0x03, 0x00, 0x07, 0x02,
+        0x11, 0x30,
+        // Prefix fd00:abcd::/32, Has Route 0x4c00.
+        0x03, 0x0b, 0x00, 0x20, 0xfd, 0x00, 0xab, 0xcd, 0x01, 0x03, 0x4c, 0x00, 0x00,
+        // Prefix fd00:abcd:ef00::/40, Has Route 0x5000.
+        0x03, 0x0c, 0x00, 0x28, 0xfd, 0x00, 0xab, 0xcd, 0xef, 0x01, 0x03, 0x50, 0x00, 0x00};
+
+    // Only the first Prefix TLV from `kNetworkData`.
+    const uint8_t kNetworkDataBrOnly[] = {
+        0x03, 0x12, 0x00, 0x30, 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01,
+        0x05, 0x04, 0x28, 0x00, 0x03, 0x00, 0x07, 0x02, 0x11, 0x30,
+    };
+
+    // Commissioning Data TLV followed by the first Prefix TLV from `kNetworkData`.
+    const uint8_t kNetworkDataWithCommissioningData[] = {
+        0x08, 0x04, 0x00, 0x01, 0x02, 0x03, 0x03, 0x12, 0x00, 0x30, 0x20, 0x01, 0x0d,
+        0xb8, 0x00, 0x01, 0x05, 0x04, 0x28, 0x00, 0x03, 0x00, 0x07, 0x02, 0x11, 0x30,
+    };
+
+    // The first length exceeds the max Network Data size, the second
+    // does not fit next to the Prefix TLV.
+    const uint8_t kTooLargeCommissioningDataLengths[] = {253, 240};
+
+    struct RouteTest
+    {
+        const char *mSource;
+        const char *mDestination;
+        Error       mError;
+        uint16_t    mRloc16;
+    };
+
+    const RouteTest kRouteTests[] = {
+        {"2001:db8:1::1", "fd00:abcd:ef00::1", kErrorNone, 0x5000},
+        {"2001:db8:1::1", "fd00:abcd:1::1", kErrorNone, 0x4c00},
+        {"2001:db8:1::1", "2002::1", kErrorNone, 0x2800},
+        {"fd00:abcd::1", "2002::1", kErrorNoRoute, 0},
+    };
+
+    const RouteTest kRouteTestsBrOnly[] = {
+        {"2001:db8:1::1", "fd00:abcd:ef00::1", kErrorNone, 0x2800},
+        {"2001:db8:1::1", "fd00:abcd:1::1", kErrorNone, 0x2800},
+    };
+
+    ot::Instance   *instance;
+    Leader         *leader;
+    Ip6::Address    address;
+    Lowpan::Context context;
+    uint8_t         commissioningData[255];
+
+    printf("\n\n-------------------------------------------------");
+    printf("\nTestNetworkDataLeaderLookups()\n");
+
+    memset(commissioningData, 0, sizeof(commissioningData));
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    leader = &instance->Get<Leader>();
+    static_cast<TestLeader *>(leader)->Populate(kNetworkData, sizeof(kNetworkData));
+
+    SuccessOrQuit(address.FromString("2001:db8:1::5"));
+    VerifyOrQuit(leader->IsOnMesh(address));
+    SuccessOrQuit(leader->GetContext(address, context));
+    VerifyOrQuit(context.mContextId == 1);
+    VerifyOrQuit(context.mCompressFlag);
+    VerifyOrQuit(context.mPrefix.GetLength() == 48);
+
+    SuccessOrQuit(leader->GetContext(1, context));
+    VerifyOrQuit(context.mPrefix.GetLength() == 48);
+    VerifyOrQuit(leader->GetContext(2, context) == kErrorNotFound);
+
+    SuccessOrQuit(address.FromString("fd00:abcd::1"));
+    VerifyOrQuit(!leader->IsOnMesh(address));
+    VerifyOrQuit(leader->GetContext(address, context) == kErrorNotFound);
+
+    for (const RouteTest &test : kRouteTests)
+    {
+        Ip6::Address source;
+        Ip6::Address destination;
+        uint16_t     rloc16 = 0;
+
+        SuccessOrQuit(source.FromString(test.mSource));
+        SuccessOrQuit(destination.FromString(test.mDestination));
+
+        VerifyOrQuit(leader->RouteLookup(source, destination, rloc16) == test.mError);
+        VerifyOrQuit(rloc16 == test.mRloc16);
+    }
+
+    // Change the Network Data and verify that lookups use the new content.
+
+    static_cast<TestLeader *>(leader)->Populate(kNetworkDataBrOnly, sizeof(kNetworkDataBrOnly));
+
+    for (const RouteTest &test : kRouteTestsBrOnly)
+    {
+        Ip6::Address source;
+        Ip6::Address destination;
+        uint16_t     rloc16 = 0;
+
+        SuccessOrQuit(source.FromString(test.mSource));
+        SuccessOrQuit(destination.FromString(test.mDestination));
+
+        VerifyOrQuit(leader->RouteLookup(source, destination, rloc16) == test.mError);
+        VerifyOrQuit(rloc16 == test.mRloc16);
+    }
+
+    // Verify that a failed `SetCommissioningData()` which removed a
+    // Commissioning Data TLV placed before the Prefix TLV does not
+    // leave stale prefix entries.
+
+    for (uint8_t length : kTooLargeCommissioningDataLengths)
+    {
+        static_cast<TestLeader *>(leader)->Populate(kNetworkDataWithCommissioningData,
+                                                    sizeof(kNetworkDataWithCommissioningData));
+        VerifyOrQuit(leader->GetCommissioningData() != nullptr);
+
+        VerifyOrQuit(leader->SetCommissioningData(commissioningData, length) == kErrorNoBufs);
+        VerifyOrQuit(leader->GetCommissioningData() == nullptr);
+
+        SuccessOrQuit(address.FromString("2001:db8:1::5"));
+        VerifyOrQuit(leader->IsOnMesh(address));
+        SuccessOrQuit(leader->GetContext(address, context));
+        VerifyOrQuit(context.mContextId == 1);
+    }
+
+    leader->Reset();
+
+    SuccessOrQuit(address.FromString("2001:db8:1::5"));
+    VerifyOrQuit(!leader->IsOnMesh(address));
+    VerifyOrQuit(leader->GetContext(1, context) == kErrorNotFound);
+
+    printf("\n-- PASS\n");
+
+    testFreeInstance(instance);
+}
+
 } // namespace NetworkData
 } // namespace ot
 
@@ -935,6 +1085,7 @@ int main(void)
 #endif
     ot::NetworkData::TestNetworkDataDsnSrpServices();
     ot::NetworkData::TestNetworkDataDsnSrpAnycastSeqNumSelection();
+    ot::NetworkData::TestNetworkDataLeaderLookups();
 
     printf("\nAll tests passed\n");
     return 0;
@@ -31,6 +31,7 @@
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
 #include "common/message.hpp"
+#include "common/num_utils.hpp"
 #include "common/random.hpp"
 #include "lib/spinel/spinel_buffer.hpp"
 
@@ -171,6 +172,40 @@ void ReadAndVerifyContent(Spinel::Buffer &aNcpBuffer, const uint8_t *aContentBuf
     }
 }
 
+// Reads bytes from the ncp buffer using `OutFrameReadChunk()` (falling back to `OutFrameReadByte()`), in runs of at
+// most `aMaxChunkLength` bytes, and verifies that it matches with the given content buffer.
+void ReadAndVerifyContentInChunks(Spinel::Buffer &aNcpBuffer,
+                                  const uint8_t  *aContentBuffer,
+                                  uint16_t        aBufferLength,
+                                  uint16_t        aMaxChunkLength)
+{
+    while (aBufferLength > 0)
+    {
+        uint16_t       chunkLength;
+        const uint8_t *chunk;
+
+        VerifyOrQuit(aNcpBuffer.OutFrameHasEnded() == false, "Out frame ended before end of expected content.");
+
+        chunk = aNcpBuffer.OutFrameReadChunk(Min(aMaxChunkLength, aBufferLength), chunkLength);
+
+        if (chunkLength == 0)
+        {
+            VerifyOrQuit(aNcpBuffer.OutFrameReadByte() == *aContentBuffer,
+                         "Out frame read byte does not match expected content");
+            chunkLength = 1;
+        }
+        else
+        {
+            VerifyOrQuit(chunkLength <= Min(aMaxChunkLength, aBufferLength), "Out frame read chunk is too long.");
+            VerifyOrQuit(memcmp(chunk, aContentBuffer, chunkLength) == 0,
+                         "Out frame read chunk does not match expected content");
+        }
+
+        aContentBuffer += chunkLength;
+        aBufferLength -= chunkLength;
+    }
+}
+
 void WriteTestFrame1(Spinel::Buffer &aNcpBuffer, Spinel::Buffer::Priority aPriority)
 {
     Message        *message;
@@ -856,6 +891,36 @@ void TestBuffer(void)
 
     printf(" -- PASS\n");
 
+    printf("\n- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    printf("\n Test 16: Test OutFrameReadChunk()");
+
+    static const uint16_t                 kMaxChunkLengths[] = {1, 5, 200};
+    static const Spinel::Buffer::Priority kPriorities[]      = {Spinel::Buffer::kPriorityLow,
+                                                                Spinel::Buffer::kPriorityHigh};
+
+    for (uint16_t maxChunkLength : kMaxChunkLengths)
+    {
+        for (Spinel::Buffer::Priority priority : kPriorities)
+        {
+            uint16_t chunkLength;
+
+            WriteTestFrame1(ncpBuffer, priority);
+            SuccessOrQuit(ncpBuffer.OutFrameBegin());
+            ReadAndVerifyContentInChunks(ncpBuffer, sMottoText, sizeof(sMottoText), maxChunkLength);
+            ReadAndVerifyContentInChunks(ncpBuffer, sMysteryText, sizeof(sMysteryText), maxChunkLength);
+            ReadAndVerifyContentInChunks(ncpBuffer, sMottoText, sizeof(sMottoText), maxChunkLength);
+            ReadAndVerifyContentInChunks(ncpBuffer, sHelloText, sizeof(sHelloText), maxChunkLength);
+            VerifyOrQuit(ncpBuffer.OutFrameHasEnded(), "Frame longer than expected.");
+            IgnoreReturnValue(ncpBuffer.OutFrameReadChunk(maxChunkLength, chunkLength));
+            VerifyOrQuit(chunkLength == 0, "ReadChunk() returned bytes after end of frame.");
+            SuccessOrQuit(ncpBuffer.OutFrameRemove());
+        }
+    }
+
+    VerifyOrQuit(ncpBuffer.IsEmpty());
+
+    printf(" -- PASS\n");
+
     testFreeInstance(sInstance);
 }
 
@@ -938,7 +1003,16 @@ otError ReadRandomFrame(uint32_t aLength, Spinel::Buffer &aNcpBuffer, uint8_t pr
     VerifyOrQuit(aNcpBuffer.OutFrameGetLength() == aLength);
 
     // Read and verify that the content is same as sFrameBuffer values...
-    ReadAndVerifyContent(aNcpBuffer, sFrameBuffer[priority], static_cast<uint16_t>(aLength));
+    if (GetRandom(2) == 0)
+    {
+        ReadAndVerifyContent(aNcpBuffer, sFrameBuffer[priority], static_cast<uint16_t>(aLength));
+    }
+    else
+    {
+        ReadAndVerifyContentInChunks(aNcpBuffer, sFrameBuffer[priority], static_cast<uint16_t>(aLength),
+                                     static_cast<uint16_t>(GetRandom(kMaxFrameLen) + 1));
+    }
+
     sExpectedRemovedTag = aNcpBuffer.OutFrameGetTag();
 
     SuccessOrQuit(aNcpBuffer.OutFrameRemove());
@@ -0,0 +1,261 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/array.hpp"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/num_utils.hpp"
+#include "thread/child_table.hpp"
+#include "thread/src_match_controller.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_FTD
+
+static constexpr uint16_t kTableSize = 3; // Size of the fake radio source match tables.
+
+static Array<uint16_t, kTableSize>        sShortTable;
+static Array<Mac::ExtAddress, kTableSize> sExtTable;
+static bool                               sSrcMatchEnabled;
+static uint16_t                           sNumAddCalls;
+
+//----------------------------------------------------------------------------------------------------------------------
+// `otPlatRadio` source match functions backed by fixed size tables.
+
+extern "C" {
+
+void otPlatRadioEnableSrcMatch(otInstance *, bool aEnable) { sSrcMatchEnabled = aEnable; }
+
+otError otPlatRadioAddSrcMatchShortEntry(otInstance *, uint16_t aShortAddress)
+{
+    sNumAddCalls++;
+    return sShortTable.PushBack(aShortAddress);
+}
+
+otError otPlatRadioAddSrcMatchExtEntry(otInstance *, const otExtAddress *aExtAddress)
+{
+    sNumAddCalls++;
+    return sExtTable.PushBack(AsCoreType(aExtAddress));
+}
+
+otError otPlatRadioClearSrcMatchShortEntry(otInstance *, uint16_t aShortAddress)
+{
+    uint16_t *entry = sShortTable.Find(aShortAddress);
+
+    VerifyOrQuit(entry != nullptr);
+    sShortTable.Remove(*entry);
+
+    return OT_ERROR_NONE;
+}
+
+otError otPlatRadioClearSrcMatchExtEntry(otInstance *, const otExtAddress *aExtAddress)
+{
+    Mac::ExtAddress *entry = sExtTable.Find(AsCoreType(aExtAddress));
+
+    VerifyOrQuit(entry != nullptr);
+    sExtTable.Remove(*entry);
+
+    return OT_ERROR_NONE;
+}
+
+void otPlatRadioClearSrcMatchShortEntries(otInstance *) { sShortTable.Clear(); }
+
+void otPlatRadioClearSrcMatchExtEntries(otInstance *) { sExtTable.Clear(); }
+
+} // extern "C"
+
+void VerifyShortTable(const uint16_t *aEntries, uint16_t aNumEntries)
+{
+    VerifyOrQuit(sShortTable.GetLength() == aNumEntries);
+
+    for (uint16_t i = 0; i < aNumEntries; i++)
+    {
+        VerifyOrQuit(sShortTable.Contains(aEntries[i]));
+    }
+}
+
+void TestBulkAddDefault(void)
+{
+    Instance      *instance;
+    const uint16_t kShortAddresses[] = {0x1001, 0x1002, 0x1003, 0x1004, 0x1005};
+    otExtAddress   extAddresses[kTableSize + 1];
+    uint16_t       numAdded;
+
+    printf("TestBulkAddDefault");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    // Entries are added in order until the table is full.
+
+    sNumAddCalls = 0;
+    VerifyOrQuit(otPlatRadioAddSrcMatchShortEntries(instance, kShortAddresses, 2, &numAdded) == OT_ERROR_NONE);
+    VerifyOrQuit(numAdded == 2);
+    VerifyOrQuit(sNumAddCalls == 2);
+    VerifyShortTable(kShortAddresses, 2);
+
+    VerifyOrQuit(otPlatRadioAddSrcMatchShortEntries(instance, &kShortAddresses[2], 3, &numAdded) ==
+                 OT_ERROR_NO_BUFS);
+    VerifyOrQuit(numAdded == 1);
+    VerifyShortTable(kShortAddresses, 3);
+
+    VerifyOrQuit(otPlatRadioAddSrcMatchShortEntries(instance, &kShortAddresses[3], 2, &numAdded) ==
+                 OT_ERROR_NO_BUFS);
+    VerifyOrQuit(numAdded == 0);
+    VerifyShortTable(kShortAddresses, 3);
+
+    VerifyOrQuit(otPlatRadioAddSrcMatchShortEntries(instance, kShortAddresses, 0, &numAdded) == OT_ERROR_NONE);
+    VerifyOrQuit(numAdded == 0);
+
+    for (uint8_t i = 0; i < GetArrayLength(extAddresses); i++)
+    {
+        memset(extAddresses[i].m8, i + 1, sizeof(otExtAddress));
+    }
+
+    sExtTable.Clear();
+    VerifyOrQuit(otPlatRadioAddSrcMatchExtEntries(instance, extAddresses, GetArrayLength(extAddresses), &numAdded) ==
+                 OT_ERROR_NO_BUFS);
+    VerifyOrQuit(numAdded == kTableSize);
+
+    for (uint16_t i = 0; i < kTableSize; i++)
+    {
+        VerifyOrQuit(sExtTable[i] == AsCoreType(&extAddresses[i]));
+    }
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(instance);
+}
+
+void TestSourceMatchController(void)
+{
+    static constexpr uint16_t kNumChildren = kTableSize + 2;
+
+    Instance              *instance;
+    SourceMatchController *controller;
+    Child                 *children[kNumChildren];
+    uint16_t               rloc16s[kNumChildren];
+
+    printf("TestSourceMatchController");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    controller = &instance->Get<SourceMatchController>();
+    VerifyOrQuit(!controller->IsEnabled());
+    VerifyOrQuit(sShortTable.IsEmpty());
+
+    for (uint16_t i = 0; i < kNumChildren; i++)
+    {
+        children[i] = instance->Get<ChildTable>().GetNewChild();
+        VerifyOrQuit(children[i] != nullptr);
+
+        rloc16s[i] = 0x1001 + i;
+        children[i]->SetState(Child::kStateValid);
+        children[i]->SetRloc16(rloc16s[i]);
+        controller->SetSrcMatchAsShort(*children[i], true);
+    }
+
+    // The first entry is added right away and enables source matching.
+
+    controller->IncrementMessageCount(*children[0]);
+    VerifyOrQuit(controller->IsEnabled());
+    VerifyOrQuit(sSrcMatchEnabled);
+    VerifyShortTable(rloc16s, 1);
+
+    // While source matching is enabled, each entry is added right
+    // away until the table is full. The entry which does not fit
+    // stays pending and source matching gets disabled.
+
+    sNumAddCalls = 0;
+
+    for (uint16_t i = 1; i <= kTableSize; i++)
+    {
+        controller->IncrementMessageCount(*children[i]);
+        VerifyShortTable(rloc16s, Min<uint16_t>(i + 1, kTableSize));
+    }
+
+    VerifyOrQuit(sNumAddCalls == kTableSize);
+    VerifyOrQuit(!controller->IsEnabled());
+    VerifyOrQuit(!sSrcMatchEnabled);
+
+    // While source matching is disabled, a new entry is added along
+    // with the pending ones, none of which fits.
+
+    sNumAddCalls = 0;
+    controller->IncrementMessageCount(*children[kTableSize + 1]);
+    VerifyOrQuit(sNumAddCalls == 1);
+    VerifyShortTable(rloc16s, kTableSize);
+    VerifyOrQuit(!controller->IsEnabled());
+
+    // Clearing an entry frees up space for one of the two pending
+    // entries, which are added as one batch. Source matching stays
+    // disabled since one entry is still pending.
+
+    sNumAddCalls = 0;
+    controller->DecrementMessageCount(*children[0]);
+    VerifyOrQuit(sNumAddCalls == 2);
+    VerifyShortTable(&rloc16s[1], kTableSize);
+    VerifyOrQuit(!controller->IsEnabled());
+
+    // An entry cleared while still pending is never added. Clearing
+    // another entry then leaves no pending entries and enables source
+    // matching.
+
+    controller->DecrementMessageCount(*children[kTableSize + 1]);
+
+    sNumAddCalls = 0;
+    controller->DecrementMessageCount(*children[1]);
+    VerifyOrQuit(sNumAddCalls == 0);
+    VerifyShortTable(&rloc16s[2], kTableSize - 1);
+    VerifyOrQuit(controller->IsEnabled());
+    VerifyOrQuit(sSrcMatchEnabled);
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(instance);
+}
+
+#endif // OPENTHREAD_FTD
+
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_FTD
+    ot::TestBulkAddDefault();
+    ot::TestSourceMatchController();
+#endif
+    printf("\nAll tests passed.\n");
+    return 0;
+}
@@ -33,6 +33,7 @@
 #include "common/debug.hpp"
 #include "common/instance.hpp"
 #include "common/num_utils.hpp"
+#include "common/random.hpp"
 #include "common/timer.hpp"
 
 enum
@@ -580,6 +581,196 @@ template <typename TimerType> int TestTenTimers(void)
     return 0;
 }
 
+template <typename TimerType>
+static void FireExpiredTimers(ot::Instance *aInstance, TestTimer<TimerType> *const aTimers[], uint16_t aNumTimers)
+{
+    // Fires all expired timers one at a time, verifying that each
+    // fired timer was the earliest one among the running timers.
+
+    while (sTimerOn && (sNow - sPlatT0 >= sPlatDt))
+    {
+        uint32_t                    handlerCount = sCallCount[kCallCountIndexTimerHandler];
+        const TestTimer<TimerType> *firedTimer   = nullptr;
+
+        AlarmFired<TimerType>(aInstance);
+
+        if (sCallCount[kCallCountIndexTimerHandler] == handlerCount)
+        {
+            continue;
+        }
+
+        VerifyOrQuit(sCallCount[kCallCountIndexTimerHandler] == handlerCount + 1);
+
+        for (uint16_t i = 0; i < aNumTimers; i++)
+        {
+            if (aTimers[i]->GetFiredCounter() != 0)
+            {
+                VerifyOrQuit(firedTimer == nullptr);
+                firedTimer = aTimers[i];
+                aTimers[i]->ResetFiredCounter();
+            }
+        }
+
+        VerifyOrQuit(firedTimer != nullptr);
+        VerifyOrQuit(!firedTimer->IsRunning());
+        VerifyOrQuit(firedTimer->GetFireTime() <= ot::Time(sNow));
+
+        for (uint16_t i = 0; i < aNumTimers; i++)
+        {
+            if (aTimers[i]->IsRunning())
+            {
+                VerifyOrQuit(aTimers[i]->GetFireTime() >= firedTimer->GetFireTime());
+            }
+        }
+    }
+
+    for (uint16_t i = 0; i < aNumTimers; i++)
+    {
+        if (aTimers[i]->IsRunning())
+        {
+            VerifyOrQuit(aTimers[i]->GetFireTime() > ot::Time(sNow));
+        }
+    }
+}
+
+/**
+ * Test the TimerScheduler with many timers being randomly restarted and stopped while time advances.
+ */
+template <typename TimerType> int TestManyTimers(void)
+{
+    const uint16_t kNumTimers   = 500;
+    const uint16_t kNumChanges  = 10000;
+    const uint32_t kMaxInterval = 5000;
+    const uint32_t kMaxTimeStep = 20;
+    const uint32_t kTimeT0      = 0xffff0000; // Close to 32-bit wrap.
+
+    ot::Instance         *instance = testInitInstance();
+    TestTimer<TimerType> *timers[kNumTimers];
+
+    printf("TestManyTimers() ");
+
+    TestTimer<TimerType>::RemoveAll(*instance);
+    InitCounters();
+
+    sNow = kTimeT0;
+
+    for (TestTimer<TimerType> *&timer : timers)
+    {
+        timer = new TestTimer<TimerType>(*instance);
+        timer->Start(ot::Random::NonCrypto::GetUint32InRange(0, kMaxInterval));
+    }
+
+    for (uint16_t change = 0; change < kNumChanges; change++)
+    {
+        TestTimer<TimerType> &timer = *timers[ot::Random::NonCrypto::GetUint16InRange(0, kNumTimers)];
+
+        if (ot::Random::NonCrypto::GetUint8InRange(0, 8) == 0)
+        {
+            timer.Stop();
+        }
+        else
+        {
+            timer.Start(ot::Random::NonCrypto::GetUint32InRange(0, kMaxInterval));
+        }
+
+        sNow += ot::Random::NonCrypto::GetUint32InRange(0, kMaxTimeStep);
+        FireExpiredTimers<TimerType>(instance, timers, kNumTimers);
+    }
+
+    while (sTimerOn)
+    {
+        sNow = sPlatT0 + sPlatDt;
+        FireExpiredTimers<TimerType>(instance, timers, kNumTimers);
+    }
+
+    for (TestTimer<TimerType> *timer : timers)
+    {
+        VerifyOrQuit(!timer->IsRunning());
+        delete timer;
+    }
+
+    printf("--> PASSED\n");
+
+    testFreeInstance(instance);
+
+    return 0;
+}
+
+/**
+ * Test that timers with the same fire time fire in the order they were (last) started.
+ */
+template <typename TimerType> int TestSameFireTime(void)
+{
+    const uint16_t kNumTimers   = 20;
+    const uint16_t kNumRestarts = 30;
+    const uint32_t kTimeT0      = 1000;
+    const uint32_t kInterval    = 10;
+
+    ot::Instance         *instance = testInitInstance();
+    TestTimer<TimerType> *timers[kNumTimers];
+    uint16_t              startOrder[kNumTimers];
+    uint16_t              numFired = 0;
+
+    printf("TestSameFireTime() ");
+
+    TestTimer<TimerType>::RemoveAll(*instance);
+    InitCounters();
+
+    sNow = kTimeT0;
+
+    for (uint16_t i = 0; i < kNumTimers; i++)
+    {
+        timers[i] = new TestTimer<TimerType>(*instance);
+        timers[i]->Start(kInterval);
+        startOrder[i] = i;
+    }
+
+    // Restarting a timer with the same fire time moves it to the end
+    // of the firing order.
+
+    for (uint16_t restart = 0; restart < kNumRestarts; restart++)
+    {
+        uint16_t index = ot::Random::NonCrypto::GetUint16InRange(0, kNumTimers);
+        uint16_t timer = startOrder[index];
+
+        memmove(&startOrder[index], &startOrder[index + 1], (kNumTimers - index - 1) * sizeof(startOrder[0]));
+        startOrder[kNumTimers - 1] = timer;
+
+        timers[timer]->Start(kInterval);
+    }
+
+    sNow = kTimeT0 + kInterval;
+
+    while (sTimerOn)
+    {
+        AlarmFired<TimerType>(instance);
+
+        for (uint16_t i = 0; i < kNumTimers; i++)
+        {
+            if (timers[i]->GetFiredCounter() != 0)
+            {
+                VerifyOrQuit(numFired < kNumTimers);
+                VerifyOrQuit(startOrder[numFired] == i, "Timers with the same fire time fired out of order");
+                numFired++;
+                timers[i]->ResetFiredCounter();
+            }
+        }
+    }
+
+    VerifyOrQuit(numFired == kNumTimers);
+
+    for (TestTimer<TimerType> *timer : timers)
+    {
+        delete timer;
+    }
+
+    printf("--> PASSED\n");
+
+    testFreeInstance(instance);
+
+    return 0;
+}
+
 /**
  * Test the `Timer::Time` class.
  */
@@ -678,6 +869,8 @@ template <typename TimerType> void RunTimerTests(void)
     TestOneTimer<TimerType>();
     TestTwoTimers<TimerType>();
     TestTenTimers<TimerType>();
+    TestManyTimers<TimerType>();
+    TestSameFireTime<TimerType>();
 }
 
 int main(void)